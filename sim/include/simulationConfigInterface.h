@@ -37,6 +37,8 @@ struct ExperimentConfig
     int numberOfInvocations;
     std::uint32_t randomSeed;
     Libraries libraries;
+    int numberOfThreads {1};                        //!< Number of threads used for the agent tasks of one timestep
+    int numberOfConcurrentInvocations {1};          //!< Number of invocations executed concurrently within one process
 };
 
 struct ScenarioConfig
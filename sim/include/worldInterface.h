@@ -228,6 +228,15 @@ public:
     //-----------------------------------------------------------------------------
     virtual void SyncGlobalData(int timestamp) = 0;
 
+    //-----------------------------------------------------------------------------
+    //! Returns the generation of the world, which changes whenever the world is
+    //! synchronized or an agent is registered. Queries evaluated in the same
+    //! generation yield the same results.
+    //!
+    //! @return generation of the world
+    //-----------------------------------------------------------------------------
+    virtual std::size_t GetGeneration() const = 0;
+
     //-----------------------------------------------------------------------------
     //! Create a scenery in world.
     //!
@@ -50,7 +50,7 @@ static std::pair<RoadGraph, RoadGraphVertex> FilterRoadGraphByStartPosition(cons
 {
     RoadGraph filteredGraph;
     auto root = FilterRoadGraphByStartPositionRecursive(roadGraph, start, maxDepth, filteredGraph);
-    return {filteredGraph, root};
+    return {std::move(filteredGraph), root};
 }
 
 //! Random draws a target leaf in the given road graph tree based on the propability of each edge
@@ -21,6 +21,9 @@
 
 #ifndef SIMULATION_STOCHASTICS_DEFINED
 
+#include <limits>
+#include <memory>
+
 #include "common/log.h"
 #include "include/stochasticsInterface.h"
 #include "bindings/stochasticsBinding.h"
@@ -112,6 +115,24 @@ public:
         return true;
     }
 
+    //! Creates an independent stochastics instance of the same library, seeded by a draw of this instance.
+    //! The sequence of the new instance depends only on the state of this instance at the time of creation.
+    //!
+    //! @return     independent stochastics instance, nullptr if this instance is not instantiated
+    std::shared_ptr<StochasticsInterface> CreateIndependentStochastics()
+    {
+        if(!stochasticsBinding || !implementation){
+            return nullptr;
+        }
+
+        auto stochastics = stochasticsBinding->InstantiateAdditional();
+        if(stochastics){
+            stochastics->InitGenerator(static_cast<std::uint32_t>(
+                implementation->GetUniformDistributed(0, std::numeric_limits<std::uint32_t>::max())));
+        }
+        return stochastics;
+    }
+
 private:
     StochasticsBinding *stochasticsBinding = nullptr;
     StochasticsInterface *implementation = nullptr;   
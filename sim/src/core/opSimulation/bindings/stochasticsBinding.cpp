@@ -48,6 +48,25 @@ StochasticsInterface* StochasticsBinding::Instantiate(std::string libraryPath)
     return library->CreateStochastics();
 }
 
+std::shared_ptr<StochasticsInterface> StochasticsBinding::InstantiateAdditional()
+{
+    if (library == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto stochastics = library->CreateAdditionalStochastics();
+    if (!stochastics)
+    {
+        return nullptr;
+    }
+
+    return {stochastics, [library = library](StochasticsInterface *stochastics)
+            {
+                library->ReleaseAdditionalStochastics(stochastics);
+            }};
+}
+
 void StochasticsBinding::Unload()
 {
     if (library != nullptr)
@@ -49,6 +49,15 @@ public:
     //-----------------------------------------------------------------------------
     StochasticsInterface *Instantiate(std::string libraryPath);
 
+    //-----------------------------------------------------------------------------
+    //! Creates a further, independent stochasticsInterface of the already
+    //! instantiated library. The library stays loaded as long as the returned
+    //! instance exists.
+    //!
+    //! @return                         StochasticsInterface created from the library
+    //-----------------------------------------------------------------------------
+    std::shared_ptr<StochasticsInterface> InstantiateAdditional();
+
     //-----------------------------------------------------------------------------
     //! Unloads the stochasticsInterface binding by deleting the library.
     //-----------------------------------------------------------------------------
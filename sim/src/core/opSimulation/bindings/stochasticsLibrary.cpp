@@ -97,36 +97,23 @@ StochasticsLibrary::~StochasticsLibrary()
 
 bool StochasticsLibrary::ReleaseStochastics()
 {
-    if(!stochasticsInterface){
-        return true;
-    }
-
-    if(!library)
+    if(!ReleaseAdditionalStochastics(stochasticsInterface))
     {
         return false;
     }
 
-    try
-    {
-        destroyInstanceFunc(stochasticsInterface);
-    }
-    catch(std::runtime_error const &ex)
-    {
-        LOG_INTERN(LogLevel::Error) << "stochastics could not be released: " << ex.what();
-        return false;
-    }
-    catch(...)
-    {
-        LOG_INTERN(LogLevel::Error) << "stochastics could not be released";
-        return false;
-    }
-
     stochasticsInterface = nullptr;
 
     return true;
 }
 
 StochasticsInterface *StochasticsLibrary::CreateStochastics()
+{
+    stochasticsInterface = CreateAdditionalStochastics();
+    return stochasticsInterface;
+}
+
+StochasticsInterface *StochasticsLibrary::CreateAdditionalStochastics()
 {
     if(!library)
     {
@@ -141,10 +128,9 @@ StochasticsInterface *StochasticsLibrary::CreateStochastics()
         }
     }
 
-    stochasticsInterface = nullptr;
     try
     {
-        stochasticsInterface = createInstanceFunc(callbacks);
+        return createInstanceFunc(callbacks);
     }
     catch(std::runtime_error const &ex)
     {
@@ -156,14 +142,35 @@ StochasticsInterface *StochasticsLibrary::CreateStochastics()
         LOG_INTERN(LogLevel::Error) << "could not create stochastics instance";
         return nullptr;
     }
+}
+
+bool StochasticsLibrary::ReleaseAdditionalStochastics(StochasticsInterface *stochastics)
+{
+    if(!stochastics){
+        return true;
+    }
 
-    if(!stochasticsInterface)
+    if(!library)
     {
-        return nullptr;
+        return false;
     }
 
+    try
+    {
+        destroyInstanceFunc(stochastics);
+    }
+    catch(std::runtime_error const &ex)
+    {
+        LOG_INTERN(LogLevel::Error) << "stochastics could not be released: " << ex.what();
+        return false;
+    }
+    catch(...)
+    {
+        LOG_INTERN(LogLevel::Error) << "stochastics could not be released";
+        return false;
+    }
 
-    return stochasticsInterface;
+    return true;
 }
 
 } // namespace core
@@ -77,6 +77,22 @@ public:
     //-----------------------------------------------------------------------------
     StochasticsInterface *CreateStochastics();
 
+    //-----------------------------------------------------------------------------
+    //! Creates a further stochastics interface of the library, which is not stored
+    //! and has to be released by ReleaseAdditionalStochastics.
+    //!
+    //! @return                         stochasticsInterface created
+    //-----------------------------------------------------------------------------
+    StochasticsInterface *CreateAdditionalStochastics();
+
+    //-----------------------------------------------------------------------------
+    //! Delete a stochastics interface created by CreateAdditionalStochastics
+    //!
+    //! @param[in]  stochastics         stochastics interface to delete
+    //! @return                         Flag if the release was successful
+    //-----------------------------------------------------------------------------
+    bool ReleaseAdditionalStochastics(StochasticsInterface *stochastics);
+
 private:
     const std::string DllGetVersionId = "OpenPASS_GetVersion";
     const std::string DllCreateInstanceId = "OpenPASS_CreateInstance";
@@ -147,6 +147,11 @@ public:
         return implementation->SyncGlobalData(timestamp);
     }
 
+    std::size_t GetGeneration() const override
+    {
+        return implementation->GetGeneration();
+    }
+
     bool CreateScenery(SceneryInterface* scenery, const SceneryDynamicsInterface& sceneryDynamics) override
     {
         return implementation->CreateScenery(scenery, sceneryDynamics);
@@ -14,12 +14,44 @@ namespace openpass::publisher {
 
 void AgentDataPublisher::Publish(const openpass::databuffer::Key &key, const openpass::databuffer::Value &value)
 {
+    if (deferred)
+    {
+        deferredCyclics.emplace_back(key, value);
+        return;
+    }
+
     dataBuffer->PutCyclic(agentId, key, value);
 }
 
 void AgentDataPublisher::Publish(const openpass::databuffer::Key &key, const openpass::databuffer::ComponentEvent &event)
 {
+    if (deferred)
+    {
+        deferredAcyclics.emplace_back(key, Acyclic(key, agentId, event.parameter));
+        return;
+    }
+
     dataBuffer->PutAcyclic(agentId, key, Acyclic(key, agentId, event.parameter));
 }
 
+void AgentDataPublisher::SetDeferred(bool deferred)
+{
+    this->deferred = deferred;
+}
+
+void AgentDataPublisher::Flush()
+{
+    for (const auto &[key, value] : deferredCyclics)
+    {
+        dataBuffer->PutCyclic(agentId, key, value);
+    }
+    deferredCyclics.clear();
+
+    for (const auto &[key, acyclic] : deferredAcyclics)
+    {
+        dataBuffer->PutAcyclic(agentId, key, acyclic);
+    }
+    deferredAcyclics.clear();
+}
+
 } // namespace openpass::publisher
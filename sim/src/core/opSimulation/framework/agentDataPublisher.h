@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include "include/dataBufferInterface.h"
 #include "include/publisherInterface.h"
 
@@ -29,8 +32,18 @@ public:
 
     void Publish(const openpass::databuffer::Key &key, const openpass::databuffer::ComponentEvent &event) override;
 
+    //! If deferred, published data is kept until the next call of Flush instead of being written into the data buffer,
+    //! so agents executed concurrently do not write into the data buffer at the same time
+    void SetDeferred(bool deferred);
+
+    //! Writes the data published since the last call into the data buffer, in the order of publishing
+    void Flush();
+
 private:
     const int agentId;
+    bool deferred{false};
+    std::vector<std::pair<openpass::databuffer::Key, openpass::databuffer::Value>> deferredCyclics;
+    std::vector<std::pair<openpass::databuffer::Key, openpass::databuffer::Acyclic>> deferredAcyclics;
 };
 
 } // namespace openpass::publisher
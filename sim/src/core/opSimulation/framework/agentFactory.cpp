@@ -47,19 +47,22 @@ AgentFactory::AgentFactory(ModelBinding *modelBinding,
                            Stochastics *stochastics,
                            ObservationNetworkInterface *observationNetwork,
                            EventNetworkInterface *eventNetwork,
-                           DataBufferWriteInterface* dataBuffer) :
+                           DataBufferWriteInterface* dataBuffer,
+                           bool independentAgentStochastics) :
     modelBinding(modelBinding),
     world(world),
     stochastics(stochastics),
     observationNetwork(observationNetwork),
     eventNetwork(eventNetwork),
-    dataBuffer(dataBuffer)
+    dataBuffer(dataBuffer),
+    independentAgentStochastics(independentAgentStochastics)
 {
 }
 
 void AgentFactory::Clear()
 {
     agentList.clear();
+    agentStochastics.clear();
 }
 
 Agent* AgentFactory::AddAgent(AgentBlueprintInterface* agentBlueprint)
@@ -95,9 +98,22 @@ std::unique_ptr<Agent> AgentFactory::CreateAgent(const AgentBlueprintInterface&
         LOG_INTERN(LogLevel::DebugCore) << "agent created (" << agent->GetId() << ")";
     }
 
+    StochasticsInterface *stochasticsOfAgent = stochastics;
+    if (independentAgentStochastics)
+    {
+        auto independentStochastics = stochastics->CreateIndependentStochastics();
+        if (!independentStochastics)
+        {
+            LOG_INTERN(LogLevel::Error) << "agent stochastics could not be instantiated";
+            return nullptr;
+        }
+        stochasticsOfAgent = independentStochastics.get();
+        agentStochastics.push_back(std::move(independentStochastics));
+    }
+
     if (!agent->Instantiate(agentBlueprint,
                             modelBinding,
-                            stochastics,
+                            stochasticsOfAgent,
                             observationNetwork,
                             eventNetwork,
                             dataBuffer))
@@ -49,7 +49,8 @@ public:
                  Stochastics *stochastics,
                  ObservationNetworkInterface *observationNetwork,
                  core::EventNetworkInterface *eventNetwork,
-                 DataBufferWriteInterface* dataBuffer);
+                 DataBufferWriteInterface* dataBuffer,
+                 bool independentAgentStochastics = false);
     virtual ~AgentFactory() override = default;
 
     virtual void Clear() override;
@@ -89,6 +90,11 @@ private:
     EventNetworkInterface *eventNetwork;
     DataBufferWriteInterface *dataBuffer;
 
+    //! if set, each agent draws from its own stochastics instance, so concurrently executed agents
+    //! neither share a generator nor depend on the order of execution
+    bool independentAgentStochastics;
+    //! declared before agentList, as the agents have to be destroyed first
+    std::vector<std::shared_ptr<StochasticsInterface>> agentStochastics;
     std::vector<std::unique_ptr<Agent>> agentList;
 };
 
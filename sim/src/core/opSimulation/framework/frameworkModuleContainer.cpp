@@ -32,7 +32,8 @@ FrameworkModuleContainer::FrameworkModuleContainer(
     manipulatorBinding(callbacks),
     manipulatorNetwork(&manipulatorBinding, &world, &coreDataPublisher),
     modelBinding(frameworkModules.libraryDir, runtimeInformation, callbacks),
-    agentFactory(&modelBinding, &world, &stochastics, &observationNetwork, &eventNetwork, &dataBuffer),
+    agentFactory(&modelBinding, &world, &stochastics, &observationNetwork, &eventNetwork, &dataBuffer,
+                 configurationContainer->GetSimulationConfig()->GetExperimentConfig().numberOfThreads > 1),
     agentBlueprintProvider(configurationContainer, stochastics),
     eventNetwork(&dataBuffer),
     spawnPointNetwork(&spawnPointBindings, &world, runtimeInformation)
@@ -15,8 +15,10 @@
 #include <QDebug>
 #include <QThreadPool>
 #include <QElapsedTimer>
+#include <QtConcurrent>
 
 #include <algorithm>
+#include <memory>
 
 #include "frameworkModules.h"
 #include "configurationFiles.h"
@@ -26,6 +28,7 @@
 #include "frameworkModuleContainer.h"
 #include "common/log.h"
 #include "runInstantiator.h"
+#include "threadSafety.h"
 
 #include "directories.h"
 #include "common/runtimeInformation.h"
@@ -65,6 +68,25 @@ static bool CheckWritableDir(const std::string& directory, const std::string& pr
 //-----------------------------------------------------------------------------
 static bool CheckDirectories(const openpass::core::Directories& directories);
 
+//-----------------------------------------------------------------------------
+//! \brief   ExecuteConcurrentRuns Distributes the invocations of the experiment on
+//!          several run instantiators, which are executed concurrently.
+//!          Each run instantiator uses its own framework modules (world, stochastics,
+//!          data buffer, ...) and writes its results into a separate output
+//!          subdirectory, while the imported configurations are shared.
+//! \param   numberOfConcurrentInvocations  number of concurrently executed invocations
+//! \param   frameworkModules               framework module libraries
+//! \param   configurationContainer         imported configurations
+//! \param   runtimeInformation             runtime information of the simulation
+//! \param   callbacks                      callbacks for the framework modules
+//! \return  true, if all run instantiators finished successfully
+//-----------------------------------------------------------------------------
+static bool ExecuteConcurrentRuns(int numberOfConcurrentInvocations,
+                                  FrameworkModules& frameworkModules,
+                                  Configuration::ConfigurationContainer& configurationContainer,
+                                  const openpass::common::RuntimeInformation& runtimeInformation,
+                                  SimulationCommon::Callbacks& callbacks);
+
 //-----------------------------------------------------------------------------
 //! Entry point of program.
 //!
@@ -125,16 +147,46 @@ int main(int argc, char* argv[])
     };
 
     SimulationCommon::Callbacks callbacks;
-    FrameworkModuleContainer frameworkModuleContainer(frameworkModules,
-                                                      &configurationContainer,
-                                                      runtimeInformation,
-                                                      &callbacks);
 
-    RunInstantiator runInstantiator(configurationContainer,
-                                    frameworkModuleContainer,
-                                    frameworkModules);
+    auto& experimentConfig = configurationContainer.GetSimulationConfig()->GetExperimentConfig();
+    if (experimentConfig.numberOfThreads > 1 || experimentConfig.numberOfConcurrentInvocations > 1)
+    {
+        if (const auto library = FindNonThreadSafeComponentLibrary(configurationContainer))
+        {
+            LOG_INTERN(LogLevel::Warning) << "component library " << library.value()
+                                          << " does not support concurrent execution, NumberOfThreads and NumberOfConcurrentInvocations are reset to 1";
+            experimentConfig.numberOfThreads = 1;
+            experimentConfig.numberOfConcurrentInvocations = 1;
+        }
+    }
+
+    const auto numberOfConcurrentInvocations = std::min(experimentConfig.numberOfConcurrentInvocations,
+                                                        experimentConfig.numberOfInvocations);
+
+    bool success{false};
+    if (numberOfConcurrentInvocations > 1)
+    {
+        success = ExecuteConcurrentRuns(numberOfConcurrentInvocations,
+                                        frameworkModules,
+                                        configurationContainer,
+                                        runtimeInformation,
+                                        callbacks);
+    }
+    else
+    {
+        FrameworkModuleContainer frameworkModuleContainer(frameworkModules,
+                                                          &configurationContainer,
+                                                          runtimeInformation,
+                                                          &callbacks);
+
+        RunInstantiator runInstantiator(configurationContainer,
+                                        frameworkModuleContainer,
+                                        frameworkModules);
 
-    if (runInstantiator.ExecuteRun())
+        success = runInstantiator.ExecuteRun();
+    }
+
+    if (success)
     {
         LOG_INTERN(LogLevel::DebugCore) << "simulation finished successfully";
     }
@@ -150,6 +202,64 @@ int main(int argc, char* argv[])
     return 0;
 }
 
+bool ExecuteConcurrentRuns(int numberOfConcurrentInvocations,
+                           FrameworkModules& frameworkModules,
+                           Configuration::ConfigurationContainer& configurationContainer,
+                           const openpass::common::RuntimeInformation& runtimeInformation,
+                           SimulationCommon::Callbacks& callbacks)
+{
+    LOG_INTERN(LogLevel::DebugCore) << "executing " << numberOfConcurrentInvocations << " invocations concurrently";
+
+    struct ConcurrentRun
+    {
+        openpass::common::RuntimeInformation runtimeInformation;
+        std::unique_ptr<FrameworkModuleContainer> frameworkModuleContainer;
+        std::unique_ptr<RunInstantiator> runInstantiator;
+    };
+
+    // runtime information is referenced by the framework modules and must not be relocated
+    std::vector<std::unique_ptr<ConcurrentRun>> concurrentRuns;
+    for (int index = 0; index < numberOfConcurrentInvocations; ++index)
+    {
+        auto concurrentRun = std::make_unique<ConcurrentRun>();
+        concurrentRun->runtimeInformation = runtimeInformation;
+        concurrentRun->runtimeInformation.directories.output =
+            openpass::core::Directories::Concat(runtimeInformation.directories.output, "Invocations_" + std::to_string(index));
+
+        concurrentRun->frameworkModuleContainer = std::make_unique<FrameworkModuleContainer>(frameworkModules,
+                                                                                             &configurationContainer,
+                                                                                             concurrentRun->runtimeInformation,
+                                                                                             &callbacks);
+        concurrentRun->runInstantiator = std::make_unique<RunInstantiator>(configurationContainer,
+                                                                           *concurrentRun->frameworkModuleContainer,
+                                                                           frameworkModules,
+                                                                           index,
+                                                                           numberOfConcurrentInvocations);
+        concurrentRuns.push_back(std::move(concurrentRun));
+    }
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(numberOfConcurrentInvocations);
+
+    std::vector<QFuture<bool>> results;
+    for (auto& concurrentRun : concurrentRuns)
+    {
+        auto* runInstantiator = concurrentRun->runInstantiator.get();
+        results.push_back(QtConcurrent::run(&threadPool, [runInstantiator]
+        {
+            return runInstantiator->ExecuteRun();
+        }));
+    }
+
+    bool success = true;
+    for (auto& result : results)
+    {
+        success = result.result() && success;
+    }
+
+    return success;
+}
+
 void SetupLogging(LogLevel logLevel, const std::string& logFile, const std::vector<std::string>& bufferedMessages)
 {
     QDir logFilePath(QString::fromStdString(logFile));
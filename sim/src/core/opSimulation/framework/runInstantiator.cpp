@@ -59,16 +59,26 @@ bool RunInstantiator::ExecuteRun()
     auto &profiles = *configurationContainer.GetProfiles();
     auto &experimentConfig = simulationConfig.GetExperimentConfig();
     auto &environmentConfig = simulationConfig.GetEnvironmentConfig();
+
+    // the DReaM components keep process-wide state, which must only be touched by a single instance
+    // (concurrent invocations are rejected for configurations using DReaM components, see main)
+    const bool usesProcessWideState = invocationStride == 1;
     //--- TU Dresden
-    GlobalObserver::Main::SetProfiles(configurationContainer.GetProfiles());
-    auto arguments = QCoreApplication::arguments();
-    auto parsedArguments = CommandLineParser::Parse(arguments);
-    std::string scenarioConfigPath =
-        QCoreApplication::applicationDirPath().toStdString() + "\\" + parsedArguments.configsPath + "\\" + "Scenario.xosc";
-    GlobalObserver::Main::SetScenarioConfigPath(scenarioConfigPath);
-    std::string scenarioResultsPath = QCoreApplication::applicationDirPath().toStdString() + "\\" +
-                                      CommandLineParser::Parse(QCoreApplication::arguments()).resultsPath + "\\";
-    GlobalObserver::AnalysisDataRecorder::SetScenarioConfigPath(scenarioResultsPath);
+    if (usesProcessWideState)
+    {
+        GlobalObserver::Main::SetProfiles(configurationContainer.GetProfiles());
+        auto arguments = QCoreApplication::arguments();
+        auto parsedArguments = CommandLineParser::Parse(arguments);
+        std::string scenarioConfigPath =
+            QCoreApplication::applicationDirPath().toStdString() + "\\" + parsedArguments.configsPath + "\\" + "Scenario.xosc";
+        GlobalObserver::Main::SetScenarioConfigPath(scenarioConfigPath);
+        std::string sceneryPath =
+            QCoreApplication::applicationDirPath().toStdString() + "\\" + parsedArguments.configsPath + "\\" + scenario.GetSceneryPath();
+        GlobalObserver::Main::SetSceneryPath(sceneryPath);
+        std::string scenarioResultsPath = QCoreApplication::applicationDirPath().toStdString() + "\\" +
+                                          CommandLineParser::Parse(QCoreApplication::arguments()).resultsPath + "\\";
+        GlobalObserver::AnalysisDataRecorder::SetScenarioConfigPath(scenarioResultsPath);
+    }
     //--
     if (!InitPreRun(scenario, scenery))
     {
@@ -80,10 +90,11 @@ bool RunInstantiator::ExecuteRun()
     dataBuffer.PutStatic("SceneryFile", scenario.GetSceneryPath(), true);
     ThrowIfFalse(observationNetwork.InitAll(), "Failed to initialize ObservationNetwork");
 
-    core::scheduling::Scheduler scheduler(world, spawnPointNetwork, eventDetectorNetwork, manipulatorNetwork, observationNetwork, dataBuffer);
+    core::scheduling::Scheduler scheduler(world, spawnPointNetwork, eventDetectorNetwork, manipulatorNetwork, observationNetwork, dataBuffer,
+                                          experimentConfig.numberOfThreads, usesProcessWideState);
     bool scheduler_state{false};
 
-    for (auto invocation = 0; invocation < experimentConfig.numberOfInvocations; invocation++)
+    for (auto invocation = firstInvocation; invocation < experimentConfig.numberOfInvocations; invocation += invocationStride)
     {
         RunResult runResult;
 
@@ -108,19 +119,26 @@ bool RunInstantiator::ExecuteRun()
         }
         LOG_INTERN(LogLevel::DebugCore) << std::endl
                                         << "### run successful ###";
-        AgentStateRecorder::AgentStateRecorder::BufferRuns(invocation);
-        AgentStateRecorder::AgentStateRecorder::ResetAgentStateRecorder(); // DReaM agents record
-        GlobalObserver::Main::Reset();
+        if (usesProcessWideState)
+        {
+            AgentStateRecorder::AgentStateRecorder::BufferRuns(invocation);
+            AgentStateRecorder::AgentStateRecorder::ResetAgentStateRecorder(); // DReaM agents record
+            GlobalObserver::Main::ResetRun(); // DReaM: keep the converted infrastructure for the next invocation
 
-        GlobalObserver::AnalysisDataRecorder::SetRunId(invocation); // DReaM: hand over run id
-        GlobalObserver::AnalysisDataRecorder::Reset();              // DReaM agents record
+            GlobalObserver::AnalysisDataRecorder::SetRunId(invocation); // DReaM: hand over run id
+            GlobalObserver::AnalysisDataRecorder::Reset();              // DReaM agents record
+        }
 
         observationNetwork.FinalizeRun(runResult);
         ClearRun();
         std::cout << "Run:" << invocation << " terminated successful" << std::endl;
     }
-    AgentStateRecorder::AgentStateRecorder::WriteOutputFile(); // DReaM: write output files
-    GlobalObserver::AnalysisDataRecorder::WriteOutput();
+    if (usesProcessWideState)
+    {
+        GlobalObserver::Main::Reset();
+        AgentStateRecorder::AgentStateRecorder::WriteOutputFile(); // DReaM: write output files
+        GlobalObserver::AnalysisDataRecorder::WriteOutput();
+    }
 
     LOG_INTERN(LogLevel::DebugCore) << std::endl
                                     << "### end of all runs ###";
@@ -38,9 +38,19 @@ namespace core {
 class SIMULATIONCOREEXPORT RunInstantiator
 {
 public:
+    //-----------------------------------------------------------------------------
+    //! @param[in] configurationContainer   Imported configurations (only read, may be shared between instances)
+    //! @param[in] frameworkModuleContainer Framework modules exclusively used by this instance
+    //! @param[in] frameworkModules         Framework module libraries
+    //! @param[in] firstInvocation          First invocation executed by this instance
+    //! @param[in] invocationStride         Distance between two invocations executed by this instance,
+    //!                                     i.e. the number of concurrently executing instances
+    //-----------------------------------------------------------------------------
     RunInstantiator(ConfigurationContainerInterface& configurationContainer,
                     FrameworkModuleContainerInterface& frameworkModuleContainer,
-                    FrameworkModules& frameworkModules) :
+                    FrameworkModules& frameworkModules,
+                    int firstInvocation = 0,
+                    int invocationStride = 1) :
         configurationContainer(configurationContainer),
         observationNetwork(*frameworkModuleContainer.GetObservationNetwork()),
         agentFactory(*frameworkModuleContainer.GetAgentFactory()),
@@ -52,7 +62,9 @@ public:
         eventDetectorNetwork(*frameworkModuleContainer.GetEventDetectorNetwork()),
         manipulatorNetwork(*frameworkModuleContainer.GetManipulatorNetwork()),
         dataBuffer(*frameworkModuleContainer.GetDataBuffer()),
-        frameworkModules{frameworkModules}
+        frameworkModules{frameworkModules},
+        firstInvocation{firstInvocation},
+        invocationStride{invocationStride}
     {}
 
     //-----------------------------------------------------------------------------
@@ -109,6 +121,8 @@ private:
     ManipulatorNetworkInterface& manipulatorNetwork;
     DataBufferInterface& dataBuffer;
     FrameworkModules& frameworkModules;
+    const int firstInvocation;
+    const int invocationStride;
 
     std::unique_ptr<ParameterInterface> worldParameter;
 };
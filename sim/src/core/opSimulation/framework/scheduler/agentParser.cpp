@@ -19,11 +19,6 @@ namespace core::scheduling {
 
 using namespace core;
 
-AgentParser::AgentParser(const int &currentTime) :
-    currentTime{currentTime}
-{
-}
-
 void AgentParser::Parse(const Agent &agent)
 {
     for (const auto &componentMap : agent.GetComponents())
@@ -38,9 +33,9 @@ void AgentParser::Parse(const Agent &agent)
         auto updateDelay = component->GetResponseTime();
         auto agentId = agent.GetId();
 
-        std::function<bool()> triggerFunc = std::bind(&ComponentInterface::TriggerCycle, component, std::ref(currentTime));
+        ComponentTask triggerTask{component, ComponentTask::Operation::TriggerCycle};
         taskItems.push_back(
-            {TriggerTaskItem(agentId, priority, cycleTime, triggerDelay, triggerFunc)});
+            {TriggerTaskItem(agentId, priority, cycleTime, triggerDelay, triggerTask)});
         //        std::cout << "Trigger Task: AgentId: " << agentId << " prio: " << priority <<
         //                      " cycleTime: " << cycleTime <<  " delay: " << triggerDelay << std::endl;
 
@@ -48,9 +43,9 @@ void AgentParser::Parse(const Agent &agent)
         {
             int outputLinkId = channel.first;
 
-            std::function<bool()> updateFunc = std::bind(&ComponentInterface::AcquireOutputData, component, outputLinkId, std::ref(currentTime));
+            ComponentTask updateTask{component, ComponentTask::Operation::AcquireOutputData, outputLinkId};
             taskItems.push_back(
-                {UpdateTaskItem(agentId, priority, cycleTime, updateDelay, updateFunc)});
+                {UpdateTaskItem(agentId, priority, cycleTime, updateDelay, updateTask)});
             //            std::cout << "UpdateOUT Task: AgentId: " << agentId << " prio: " << priority <<
             //                          " cycleTime: " << cycleTime <<  " delay: " << updateDelay << std::endl;
 
@@ -59,9 +54,9 @@ void AgentParser::Parse(const Agent &agent)
                 int targetLinkId = std::get<static_cast<size_t>(Channel::TargetLinkType::LinkId)>(target);
                 ComponentInterface *targetComponent = std::get<static_cast<size_t>(Channel::TargetLinkType::Component)>(target);
 
-                std::function<bool()> updateInFunc = std::bind(&ComponentInterface::UpdateInputData, targetComponent, targetLinkId, std::ref(currentTime));
+                ComponentTask updateInTask{targetComponent, ComponentTask::Operation::UpdateInputData, targetLinkId};
                 taskItems.push_back(
-                    {UpdateTaskItem(agentId, priority, cycleTime, updateDelay, updateInFunc)});
+                    {UpdateTaskItem(agentId, priority, cycleTime, updateDelay, updateInTask)});
                 //                std::cout << "UpdateIN Task: AgentId: " << agentId << " prio: " << priority <<
                 //                              " cycleTime: " << cycleTime <<  " delay: " << updateDelay << std::endl;
             }
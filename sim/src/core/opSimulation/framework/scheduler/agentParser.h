@@ -19,7 +19,6 @@
 
 #pragma once
 
-#include <functional>
 #include <list>
 
 #include "agent.h"
@@ -40,10 +39,8 @@ private:
     std::vector<TaskItem> nonRecurringTasks;
     std::vector<TaskItem> recurringTasks;
 
-    const int &currentTime;
-
 public:
-    AgentParser(const int &currentTime);
+    AgentParser() = default;
 
     /*!
     * \brief Parse
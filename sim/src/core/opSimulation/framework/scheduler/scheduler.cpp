@@ -11,8 +11,11 @@
 
 #include "scheduler.h"
 
+#include <algorithm>
+
 #include "../../../../tudresden/components/DriverReactionModel/AgentStateRecorder/AgentStateRecorder.h" //DReaM
 #include "agent.h"
+#include "agentDataPublisher.h"
 #include "agentParser.h"
 #include "common/log.h"
 #include "eventNetwork.h"
@@ -23,19 +26,49 @@ namespace core::scheduling {
 
 using namespace core;
 
+namespace {
+
+//! Executes the given work on a thread of the scheduler thread pool
+class AgentTaskWorker : public QRunnable
+{
+public:
+    explicit AgentTaskWorker(std::function<void()> work) :
+        work{std::move(work)}
+    {
+    }
+
+    void run() override
+    {
+        work();
+    }
+
+private:
+    std::function<void()> work;
+};
+
+} // namespace
+
 Scheduler::Scheduler(WorldInterface &world,
                      SpawnPointNetworkInterface &spawnPointNetwork,
                      EventDetectorNetworkInterface &eventDetectorNetwork,
                      ManipulatorNetworkInterface &manipulatorNetwork,
                      ObservationNetworkInterface &observationNetwork,
-                     DataBufferInterface &dataInterface) :
+                     DataBufferInterface &dataInterface,
+                     int numberOfThreads,
+                     bool recordAgentStates) :
     world(world),
     spawnPointNetwork(spawnPointNetwork),
     eventDetectorNetwork(eventDetectorNetwork),
     manipulatorNetwork(manipulatorNetwork),
     observationNetwork(observationNetwork),
-    dataInterface(dataInterface)
+    dataInterface(dataInterface),
+    numberOfThreads(std::max(1, numberOfThreads)),
+    recordAgentStates(recordAgentStates),
+    agentTaskWorker(std::make_unique<AgentTaskWorker>([this] { ExecuteAgentTaskGroups(); }))
 {
+    // the calling thread takes part in the execution of the agent tasks
+    threadPool.setMaxThreadCount(std::max(1, this->numberOfThreads - 1));
+    agentTaskWorker->setAutoDelete(false);
 }
 
 bool Scheduler::Run(
@@ -51,6 +84,7 @@ bool Scheduler::Run(
     }
 
     currentTime = startTime;
+    deferredPublishers.clear();
 
     TaskBuilder taskBuilder(currentTime,
                             runResult,
@@ -83,21 +117,38 @@ bool Scheduler::Run(
 
     while (currentTime <= endTime)
     {
-        if (!ExecuteTasks(taskList.GetSpawningTasks(currentTime)))
+        taskList.GetSpawningTasks(currentTime, currentTasks);
+        if (!ExecuteTasks(currentTasks))
         {
             return Scheduler::FAILURE;
         }
 
         UpdateAgents(taskList, world);
 
-        if (!ExecuteTasks(taskList.GetPreAgentTasks(currentTime)) ||
-            !ExecuteTasks(taskList.ConsumeNonRecurringAgentTasks(currentTime)) ||
-            !ExecuteTasks(taskList.GetRecurringAgentTasks(currentTime)) ||
-            !ExecuteTasks(taskList.GetSynchronizeTasks(currentTime)))
+        taskList.GetPreAgentTasks(currentTime, currentTasks);
+        if (!ExecuteTasks(currentTasks) ||
+            !ExecuteTasks(taskList.ConsumeNonRecurringAgentTasks(currentTime)))
+        {
+            return Scheduler::FAILURE;
+        }
+
+        taskList.GetRecurringAgentTasks(currentTime, currentTasks);
+        const auto agentTasksSucceeded = ExecuteAgentTasks(currentTasks);
+        FlushDeferredPublishers();
+        if (!agentTasksSucceeded)
+        {
+            return Scheduler::FAILURE;
+        }
+
+        taskList.GetSynchronizeTasks(currentTime, currentTasks);
+        if (!ExecuteTasks(currentTasks))
         {
             return Scheduler::FAILURE;
         }
-        AgentStateRecorder::AgentStateRecorder::BufferSamples(currentTime);
+        if (recordAgentStates)
+        {
+            AgentStateRecorder::AgentStateRecorder::BufferSamples(currentTime);
+        }
         currentTime = taskList.GetNextTimestamp(currentTime);
 
         if (runResult.IsEndCondition())
@@ -122,7 +173,7 @@ bool Scheduler::ExecuteTasks(T tasks)
 {
     for (const auto &task : tasks)
     {
-        if (task.func() == false)
+        if (task.Execute(currentTime) == false)
         {
             return false;
         }
@@ -130,25 +181,141 @@ bool Scheduler::ExecuteTasks(T tasks)
     return true;
 }
 
+bool Scheduler::ExecuteTasks(const std::vector<const TaskItem *> &tasks)
+{
+    for (const auto *task : tasks)
+    {
+        if (task->Execute(currentTime) == false)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Scheduler::ExecuteAgentTasks(const std::vector<TaskItem> &tasks)
+{
+    std::vector<const TaskItem *> taskPointers;
+    taskPointers.reserve(tasks.size());
+    for (const auto &task : tasks)
+    {
+        taskPointers.push_back(&task);
+    }
+    return ExecuteAgentTasks(taskPointers);
+}
+
+bool Scheduler::ExecuteAgentTasks(const std::vector<const TaskItem *> &tasks)
+{
+    if (numberOfThreads == 1)
+    {
+        return ExecuteTasks(tasks);
+    }
+
+    // sorting by (agent id, position) groups the tasks of each agent and keeps their order
+    agentTaskOrder.clear();
+    for (std::size_t index = 0; index < tasks.size(); ++index)
+    {
+        agentTaskOrder.emplace_back(tasks[index]->agentId, index);
+    }
+    std::sort(agentTaskOrder.begin(), agentTaskOrder.end());
+
+    agentTaskGroups.clear();
+    for (std::size_t index = 0; index < agentTaskOrder.size(); ++index)
+    {
+        if (index == 0 || agentTaskOrder[index].first != agentTaskOrder[index - 1].first)
+        {
+            agentTaskGroups.push_back(index);
+        }
+    }
+    const auto numberOfGroups = agentTaskGroups.size();
+    agentTaskGroups.push_back(agentTaskOrder.size());
+
+    agentTasks = &tasks;
+    nextAgentTaskGroup = 0;
+    agentTaskFailed = false;
+    agentTaskException = nullptr;
+
+    const auto numberOfWorkers = std::min(static_cast<std::size_t>(numberOfThreads), numberOfGroups);
+    for (std::size_t worker = 1; worker < numberOfWorkers; ++worker)
+    {
+        threadPool.start(agentTaskWorker.get());
+    }
+    ExecuteAgentTaskGroups();
+    threadPool.waitForDone();
+
+    if (agentTaskException)
+    {
+        std::rethrow_exception(agentTaskException);
+    }
+
+    return !agentTaskFailed;
+}
+
+void Scheduler::ExecuteAgentTaskGroups()
+{
+    const auto numberOfGroups = agentTaskGroups.size() - 1;
+
+    // each thread fetches the next pending agent, so busy agents do not stall the others
+    for (auto group = nextAgentTaskGroup++; group < numberOfGroups && !agentTaskFailed; group = nextAgentTaskGroup++)
+    {
+        try
+        {
+            for (auto index = agentTaskGroups[group]; index < agentTaskGroups[group + 1]; ++index)
+            {
+                if ((*agentTasks)[agentTaskOrder[index].second]->Execute(currentTime) == false)
+                {
+                    agentTaskFailed = true;
+                    break;
+                }
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(agentTaskExceptionMutex);
+            if (!agentTaskException)
+            {
+                agentTaskException = std::current_exception();
+            }
+            agentTaskFailed = true;
+        }
+    }
+}
+
+void Scheduler::FlushDeferredPublishers()
+{
+    for (auto &[agentId, publisher] : deferredPublishers)
+    {
+        publisher->Flush();
+    }
+}
+
 void Scheduler::UpdateAgents(SchedulerTasks &taskList, WorldInterface &world)
 {
     for (const auto &agent : spawnPointNetwork.ConsumeNewAgents())
     {
         agent->LinkSchedulerTime(&currentTime);
         ScheduleAgentTasks(taskList, *agent);
+
+        // data published concurrently is kept per agent until the agent tasks of the timestep are done
+        if (auto publisher = agent->GetPublisher(); publisher && numberOfThreads > 1)
+        {
+            publisher->SetDeferred(true);
+            deferredPublishers[agent->GetId()] = publisher;
+        }
     }
 
     std::vector<int> removedAgents;
     for (const auto &agent: world.GetRemovedAgentsInPreviousTimestep())
     {
         removedAgents.push_back(agent->GetId());
+        deferredPublishers.erase(agent->GetId());
     }
     taskList.DeleteAgentTasks(removedAgents);
 }
 
 void Scheduler::ScheduleAgentTasks(SchedulerTasks &taskList, const Agent &agent)
 {
-    AgentParser agentParser(currentTime);
+    AgentParser agentParser;
     agentParser.Parse(agent);
 
     taskList.ScheduleNewRecurringTasks(agentParser.GetRecurringTasks());
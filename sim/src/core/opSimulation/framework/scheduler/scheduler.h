@@ -11,14 +11,27 @@
 
 #pragma once
 
+#include <atomic>
+#include <exception>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <QRunnable>
+#include <QThreadPool>
 
 #include "include/worldInterface.h"
 #include "schedulerTasks.h"
 
 class DataBufferInterface;
 
+namespace openpass::publisher {
+class AgentDataPublisher;
+}
+
 namespace core {
 class Agent;
 class RunResult;
@@ -52,7 +65,9 @@ public:
               core::EventDetectorNetworkInterface &eventDetectorNetwork,
               core::ManipulatorNetworkInterface &manipulatorNetwork,
               core::ObservationNetworkInterface &observationNetwork,
-              DataBufferInterface& dataInterface);
+              DataBufferInterface& dataInterface,
+              int numberOfThreads = 1,
+              bool recordAgentStates = true);
 
     /*!
     * \brief Run
@@ -81,6 +96,22 @@ public:
     */
     void ScheduleAgentTasks(SchedulerTasks &taskList, const Agent &agent);
 
+    /*!
+    * \brief ExecuteAgentTasks
+    *
+    * \details execute the given agent tasks. If more than one thread is configured,
+    *          the tasks are grouped by agent id and the groups are distributed on
+    *          the thread pool. Within a group the order of the given tasks is kept.
+    *          Returns after all groups have been executed.
+    *
+    * @param[in]     tasks     agent tasks of the current timestamp
+    * @return                  false, if a task reports error
+    */
+    bool ExecuteAgentTasks(const std::vector<TaskItem> &tasks);
+
+    //! \copydoc ExecuteAgentTasks(const std::vector<TaskItem> &)
+    bool ExecuteAgentTasks(const std::vector<const TaskItem *> &tasks);
+
 private:
     WorldInterface &world;
     SpawnPointNetworkInterface &spawnPointNetwork;
@@ -90,6 +121,29 @@ private:
     DataBufferInterface& dataInterface;
 
     int currentTime;
+    int numberOfThreads;
+    //! buffer the samples of the process-wide DReaM agent state recorder after each timestep
+    bool recordAgentStates;
+
+    //! due tasks of the currently executed phase, reused for each timestamp
+    std::vector<const TaskItem *> currentTasks;
+
+    //! agent tasks ordered by (agent id, position), reused for each timestamp
+    std::vector<std::pair<int, std::size_t>> agentTaskOrder;
+    //! begin of each agent in agentTaskOrder, followed by its end
+    std::vector<std::size_t> agentTaskGroups;
+    const std::vector<const TaskItem *> *agentTasks{nullptr};
+    std::atomic<std::size_t> nextAgentTaskGroup{0};
+    std::atomic<bool> agentTaskFailed{false};
+    std::exception_ptr agentTaskException;
+    std::mutex agentTaskExceptionMutex;
+
+    //! started on the thread pool for each additional thread (not auto deleted)
+    std::unique_ptr<QRunnable> agentTaskWorker;
+    QThreadPool threadPool;
+
+    //! publishers of the scheduled agents ordered by agent id, deferred if more than one thread is configured
+    std::map<int, openpass::publisher::AgentDataPublisher *> deferredPublishers;
 
     /*!
     * \brief UpdateAgents
@@ -112,6 +166,26 @@ private:
     */
     template <typename T>
     bool ExecuteTasks(T tasks);
+
+    //! \copydoc ExecuteTasks
+    bool ExecuteTasks(const std::vector<const TaskItem *> &tasks);
+
+    /*!
+    * \brief ExecuteAgentTaskGroups
+    *
+    * \details executes pending agent task groups until all groups are taken,
+    *          called concurrently by each thread
+    */
+    void ExecuteAgentTaskGroups();
+
+    /*!
+    * \brief FlushDeferredPublishers
+    *
+    * \details writes the data published by the agents during the concurrent
+    *          execution into the data buffer, ordered by agent id so the
+    *          content of the data buffer does not depend on the thread scheduling
+    */
+    void FlushDeferredPublishers();
 };
 
 } // namespace scheduling
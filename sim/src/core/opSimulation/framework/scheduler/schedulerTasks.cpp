@@ -29,11 +29,11 @@ SchedulerTasks::SchedulerTasks(std::vector<TaskItem> bootstrapTasks,
                                std::vector<TaskItem> finalizeTasks,
                                int scheduledTimestampsInterval)
 {
-    this->bootstrapTasks.tasks = std::multiset<TaskItem>(bootstrapTasks.begin(), bootstrapTasks.end());
-    this->spawningTasks.tasks = std::multiset<TaskItem>(spawningTasks.begin(), spawningTasks.end());
-    this->preAgentTasks.tasks = std::multiset<TaskItem>(preAgentTasks.begin(), preAgentTasks.end());
-    this->synchronizeTasks.tasks = std::multiset<TaskItem>(synchronizeTasks.begin(), synchronizeTasks.end());
-    this->finalizeTasks.tasks = std::multiset<TaskItem>(finalizeTasks.begin(), finalizeTasks.end());
+    AddTasks(this->bootstrapTasks, bootstrapTasks);
+    AddTasks(this->spawningTasks, spawningTasks);
+    AddTasks(this->preAgentTasks, preAgentTasks);
+    AddTasks(this->synchronizeTasks, synchronizeTasks);
+    AddTasks(this->finalizeTasks, finalizeTasks);
 
     this->scheduledTimestampsInterval = scheduledTimestampsInterval;
     lowerBoundOfScheduledTimestamps = 0;
@@ -41,6 +41,14 @@ SchedulerTasks::SchedulerTasks(std::vector<TaskItem> bootstrapTasks,
     CreateNewScheduledTimestamps();
 }
 
+void SchedulerTasks::AddTasks(Tasks &tasks, const std::vector<TaskItem> &newTasks)
+{
+    for (const auto &newTask : newTasks)
+    {
+        tasks.AddTask(newTask);
+    }
+}
+
 void SchedulerTasks::ScheduleNewRecurringTasks(std::vector<TaskItem> newTasks)
 {
     ScheduleNewTasks(recurringAgentTasks, std::move(newTasks));
@@ -90,11 +98,11 @@ void SchedulerTasks::UpdateScheduledTimestamps(int cycleTime, int delay)
     // scheduledTimesteps higher than horizon will be considered on next timestamp
 }
 
-void SchedulerTasks::UpdateScheduledTimestamps(std::multiset<TaskItem> &tasks)
+void SchedulerTasks::UpdateScheduledTimestamps(const Tasks &tasks)
 {
-    for (const auto &task : tasks)
+    for (const auto &[cycleTime, delay] : tasks.GetSchedules())
     {
-        UpdateScheduledTimestamps(task.cycletime, task.delay);
+        UpdateScheduledTimestamps(cycleTime, delay);
     }
 }
 
@@ -104,9 +112,9 @@ void SchedulerTasks::CreateNewScheduledTimestamps()
     scheduledTimestamps.insert(lowerBoundOfScheduledTimestamps);
     scheduledTimestamps.insert(upperBoundOfScheduledTimestamps);
 
-    UpdateScheduledTimestamps(spawningTasks.tasks);
-    UpdateScheduledTimestamps(recurringAgentTasks.tasks);
-    UpdateScheduledTimestamps(nonRecurringAgentTasks.tasks);
+    UpdateScheduledTimestamps(spawningTasks);
+    UpdateScheduledTimestamps(recurringAgentTasks);
+    UpdateScheduledTimestamps(nonRecurringAgentTasks);
 }
 
 int SchedulerTasks::GetNextTimestamp(int timestamp)
@@ -135,21 +143,15 @@ void SchedulerTasks::ExpandUpperBoundary(int timestamp)
     // we are not time travelling.. backwards is illogical
 }
 
-void SchedulerTasks::GetTasks(int timestamp, std::multiset<TaskItem> &tasks, std::vector<TaskItem> &currentTasks)
+void SchedulerTasks::GetTasks(int timestamp, const Tasks &tasks, std::vector<TaskItem> &currentTasks)
 {
-    for (const auto &task : tasks)
-    {
-        if (task.cycletime == 0)
-        {
-            currentTasks.push_back(task);
-            continue;
-        }
+    tasks.GetDueTasks(timestamp, currentTasks);
+}
 
-        if ((timestamp - task.delay) % task.cycletime == 0)
-        {
-            currentTasks.push_back(task);
-        }
-    }
+void SchedulerTasks::GetTasks(int timestamp, const Tasks &tasks, std::vector<const TaskItem *> &currentTasks)
+{
+    currentTasks.clear();
+    tasks.GetDueTasks(timestamp, currentTasks);
 }
 
 std::vector<TaskItem> SchedulerTasks::GetTasks(int timestamp)
@@ -162,10 +164,10 @@ std::vector<TaskItem> SchedulerTasks::GetTasks(int timestamp)
         return currentTasks;
     }
 
-    GetTasks(timestamp, spawningTasks.tasks, currentTasks);
+    GetTasks(timestamp, spawningTasks, currentTasks);
     PullNonRecurringTasks(timestamp, currentTasks);
-    GetTasks(timestamp, recurringAgentTasks.tasks, currentTasks);
-    GetTasks(timestamp, synchronizeTasks.tasks, currentTasks);
+    GetTasks(timestamp, recurringAgentTasks, currentTasks);
+    GetTasks(timestamp, synchronizeTasks, currentTasks);
 
     return currentTasks;
 }
@@ -173,14 +175,14 @@ std::vector<TaskItem> SchedulerTasks::GetTasks(int timestamp)
 std::vector<TaskItem> SchedulerTasks::GetSpawningTasks(int timestamp)
 {
     std::vector<TaskItem> currentTasks;
-    GetTasks(timestamp, spawningTasks.tasks, currentTasks);
+    GetTasks(timestamp, spawningTasks, currentTasks);
     return currentTasks;
 }
 
 std::vector<TaskItem> SchedulerTasks::GetPreAgentTasks(int timestamp)
 {
     std::vector<TaskItem> currentTasks;
-    GetTasks(timestamp, preAgentTasks.tasks, currentTasks);
+    GetTasks(timestamp, preAgentTasks, currentTasks);
     return currentTasks;
 }
 
@@ -194,23 +196,43 @@ std::vector<TaskItem> SchedulerTasks::ConsumeNonRecurringAgentTasks(int timestam
 std::vector<TaskItem> SchedulerTasks::GetRecurringAgentTasks(int timestamp)
 {
     std::vector<TaskItem> currentTasks;
-    GetTasks(timestamp, recurringAgentTasks.tasks, currentTasks);
+    GetTasks(timestamp, recurringAgentTasks, currentTasks);
     return currentTasks;
 }
 
 std::vector<TaskItem> SchedulerTasks::GetSynchronizeTasks(int timestamp)
 {
     std::vector<TaskItem> currentTasks;
-    GetTasks(timestamp, synchronizeTasks.tasks, currentTasks);
+    GetTasks(timestamp, synchronizeTasks, currentTasks);
     return currentTasks;
 }
 
 void SchedulerTasks::PullNonRecurringTasks(int timestamp, std::vector<TaskItem> &currentTasks)
 {
-    GetTasks(timestamp, nonRecurringAgentTasks.tasks, currentTasks);
+    GetTasks(timestamp, nonRecurringAgentTasks, currentTasks);
     ClearNonrecurringTasks();
 }
 
+void SchedulerTasks::GetSpawningTasks(int timestamp, std::vector<const TaskItem *> &currentTasks) const
+{
+    GetTasks(timestamp, spawningTasks, currentTasks);
+}
+
+void SchedulerTasks::GetPreAgentTasks(int timestamp, std::vector<const TaskItem *> &currentTasks) const
+{
+    GetTasks(timestamp, preAgentTasks, currentTasks);
+}
+
+void SchedulerTasks::GetRecurringAgentTasks(int timestamp, std::vector<const TaskItem *> &currentTasks) const
+{
+    GetTasks(timestamp, recurringAgentTasks, currentTasks);
+}
+
+void SchedulerTasks::GetSynchronizeTasks(int timestamp, std::vector<const TaskItem *> &currentTasks) const
+{
+    GetTasks(timestamp, synchronizeTasks, currentTasks);
+}
+
 std::multiset<TaskItem> SchedulerTasks::GetBootstrapTasks()
 {
     return bootstrapTasks.tasks;
@@ -223,7 +245,7 @@ std::multiset<TaskItem> SchedulerTasks::GetFinalizeTasks()
 
 void SchedulerTasks::ClearNonrecurringTasks()
 {
-    nonRecurringAgentTasks.tasks.clear();
+    nonRecurringAgentTasks.Clear();
 }
 
 void SchedulerTasks::DeleteAgentTasks(int agentId)
@@ -136,6 +136,25 @@ public:
 
     std::vector<TaskItem> GetSynchronizeTasks(int timestamp);
 
+    /*!
+    * \brief GetSpawningTasks
+    *
+    * \details Variants of the getters above, which do not copy the tasks.
+    *          The given list is cleared and filled with pointers to the due
+    *          tasks, so a list reused for each timestamp does not allocate.
+    *          The pointers are valid until tasks are scheduled or deleted.
+    *
+    * @param[in]     int                        timestamp
+    * @param[out]    list of TaskItem pointers  all spawning tasks for given timestamp
+    */
+    void GetSpawningTasks(int timestamp, std::vector<const TaskItem *> &currentTasks) const;
+
+    void GetPreAgentTasks(int timestamp, std::vector<const TaskItem *> &currentTasks) const;
+
+    void GetRecurringAgentTasks(int timestamp, std::vector<const TaskItem *> &currentTasks) const;
+
+    void GetSynchronizeTasks(int timestamp, std::vector<const TaskItem *> &currentTasks) const;
+
     /*!
     * \brief GetBootstrapTasks
     *
@@ -177,7 +196,16 @@ private:
     * @param[in]     tasks              tasks to filter by current timestamp
     * @param[out]    list of TaskItems  filtered tasks
     */
-    void GetTasks(int timestamp, std::multiset<TaskItem> &tasks, std::vector<TaskItem> &currentTasks);
+    void GetTasks(int timestamp, const Tasks &tasks, std::vector<TaskItem> &currentTasks);
+
+    /*!
+    * \brief GetTasks
+    *
+    * @param[in]     int                        timestamp
+    * @param[in]     tasks                      tasks to filter by current timestamp
+    * @param[out]    list of TaskItem pointers  filtered tasks (cleared beforehand)
+    */
+    static void GetTasks(int timestamp, const Tasks &tasks, std::vector<const TaskItem *> &currentTasks);
 
     /*!
     * \brief UpdateScheduledTimestamps
@@ -192,11 +220,21 @@ private:
     /*!
     * \brief UpdateScheduledTimestamps
     *
-    * \details call UpdateScheduledTimestamps for each task
+    * \details call UpdateScheduledTimestamps for each schedule of the given tasks
     *
-    * @param[out]     tasks     new scheduled tasks
+    * @param[in]     tasks     scheduled tasks
+    */
+    void UpdateScheduledTimestamps(const Tasks &tasks);
+
+    /*!
+    * \brief AddTasks
+    *
+    * \details add given tasks without updating the scheduled timestamps
+    *
+    * @param[out]    tasks      tasks to extend
+    * @param[in]     newTasks   new tasks
     */
-    void UpdateScheduledTimestamps(std::multiset<TaskItem> &tasks);
+    static void AddTasks(Tasks &tasks, const std::vector<TaskItem> &newTasks);
 
     /*!
     * \brief ScheduleNewTasks
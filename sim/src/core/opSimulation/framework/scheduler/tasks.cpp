@@ -10,6 +10,10 @@
 
 #include "tasks.h"
 
+#include <iterator>
+
+#include "include/componentInterface.h"
+
 //-----------------------------------------------------------------------------
 /** \file  Tasks.cpp */
 //-----------------------------------------------------------------------------
@@ -18,23 +22,139 @@ namespace core::scheduling {
 
 void Tasks::AddTask(const TaskItem &newTask)
 {
-    tasks.insert(newTask);
+    const auto task = tasks.insert(newTask);
+    auto &scheduledTasks = schedules[{newTask.cycletime, newTask.delay}];
+    const auto scheduledTask = scheduledTasks.insert({newTask.priority, newTask.taskType, nextSequence++, task}).first;
+    agentTasks[newTask.agentId].push_back(scheduledTask);
+    isDueTasksCacheValid = false;
 }
 
 void Tasks::DeleteTasks(int agentId)
 {
-    auto it = tasks.begin();
-    while (it != tasks.end())
+    const auto agentTasksIter = agentTasks.find(agentId);
+    if (agentTasksIter == agentTasks.end())
+    {
+        return;
+    }
+
+    for (const auto &scheduledTask : agentTasksIter->second)
+    {
+        const auto task = scheduledTask->task;
+        const auto schedule = schedules.find({task->cycletime, task->delay});
+
+        schedule->second.erase(scheduledTask);
+        if (schedule->second.empty())
+        {
+            schedules.erase(schedule);
+        }
+        tasks.erase(task);
+    }
+
+    agentTasks.erase(agentTasksIter);
+    isDueTasksCacheValid = false;
+}
+
+void Tasks::Clear()
+{
+    agentTasks.clear();
+    schedules.clear();
+    tasks.clear();
+    isDueTasksCacheValid = false;
+}
+
+void Tasks::CollectDueSchedules(int timestamp) const
+{
+    dueSchedules.clear();
+    dueScheduleKeys.clear();
+
+    for (const auto &[schedule, scheduledTasks] : schedules)
     {
-        if ((*it).agentId == agentId)
+        const auto &[cycleTime, delay] = schedule;
+        if (cycleTime == 0 || (timestamp - delay) % cycleTime == 0)
         {
-            it = tasks.erase(it);
+            dueSchedules.emplace_back(scheduledTasks.cbegin(), scheduledTasks.cend());
+            dueScheduleKeys.push_back(schedule);
         }
-        else
+    }
+}
+
+template <typename Visitor>
+void Tasks::MergeDueSchedules(Visitor &&visit) const
+{
+    // merge the (already sorted) schedules, so the order of the multiset is kept
+    while (!dueSchedules.empty())
+    {
+        auto next = dueSchedules.begin();
+        for (auto dueSchedule = std::next(next); dueSchedule != dueSchedules.end(); ++dueSchedule)
         {
-            ++it;
+            if (*dueSchedule->first < *next->first)
+            {
+                next = dueSchedule;
+            }
         }
+
+        visit(*next->first->task);
+
+        if (++next->first == next->second)
+        {
+            dueSchedules.erase(next);
+        }
+    }
+}
+
+void Tasks::GetDueTasks(int timestamp, std::vector<TaskItem> &dueTasks) const
+{
+    CollectDueSchedules(timestamp);
+    MergeDueSchedules([&dueTasks](const TaskItem &task) { dueTasks.push_back(task); });
+}
+
+void Tasks::GetDueTasks(int timestamp, std::vector<const TaskItem *> &dueTasks) const
+{
+    CollectDueSchedules(timestamp);
+
+    if (!isDueTasksCacheValid || dueScheduleKeys != cachedDueScheduleKeys)
+    {
+        cachedDueTasks.clear();
+        MergeDueSchedules([this](const TaskItem &task) { cachedDueTasks.push_back(&task); });
+        cachedDueScheduleKeys = dueScheduleKeys;
+        isDueTasksCacheValid = true;
+    }
+
+    dueTasks.insert(dueTasks.end(), cachedDueTasks.cbegin(), cachedDueTasks.cend());
+}
+
+std::vector<Tasks::Schedule> Tasks::GetSchedules() const
+{
+    std::vector<Schedule> result;
+    result.reserve(schedules.size());
+    for (const auto &[schedule, scheduledTasks] : schedules)
+    {
+        result.push_back(schedule);
+    }
+    return result;
+}
+
+bool Tasks::ScheduledTask::operator<(const ScheduledTask &rhs) const
+{
+    return (priority > rhs.priority ||
+            ((priority == rhs.priority) && (taskType < rhs.taskType)) ||
+            ((priority == rhs.priority) && (taskType == rhs.taskType) && (sequence < rhs.sequence)));
+}
+
+bool ComponentTask::Execute(int time) const
+{
+    switch (operation)
+    {
+    case Operation::TriggerCycle:
+        return component->TriggerCycle(time);
+    case Operation::AcquireOutputData:
+        return component->AcquireOutputData(linkId, time);
+    case Operation::UpdateInputData:
+        return component->UpdateInputData(linkId, time);
+    case Operation::None:
+        break;
     }
+    return false;
 }
 
 bool TaskItem::operator<(const TaskItem &rhs) const
@@ -18,9 +18,19 @@
 */
 //-----------------------------------------------------------------------------
 
+#include <cstdint>
 #include <exception>
 #include <functional>
+#include <map>
 #include <set>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace core {
+class ComponentInterface;
+}
 
 namespace core::scheduling {
 
@@ -36,8 +46,46 @@ enum TaskType
     SyncGlobalData
 };
 
+//-----------------------------------------------------------------------------
+/** \brief call of a component method, executed by an agent task
+*   \details Replaces a bound std::function for the component tasks, so
+*            copying and executing an agent task never allocates.
+*
+*   \ingroup opSimulation
+*/
+//-----------------------------------------------------------------------------
+
+struct ComponentTask
+{
+    enum class Operation : std::uint8_t
+    {
+        None,
+        TriggerCycle,
+        AcquireOutputData,
+        UpdateInputData
+    };
+
+    ComponentInterface *component{nullptr};
+    Operation operation{Operation::None};
+    int linkId{0};
+
+    /*!
+    * \brief Execute
+    *
+    * \details calls the component method given by the operation
+    *
+    * @param[in]     int     current simulation time
+    * @return                result of the component method
+    */
+    bool Execute(int time) const;
+};
+
+static_assert(std::is_trivially_copyable_v<ComponentTask>, "ComponentTask has to be copied without allocation");
+
 //-----------------------------------------------------------------------------
 /** \brief handles data to store scheduler tasks
+*   \details A task either executes a component method (componentTask) or
+*            the given function (func).
 *
 *   \ingroup opSimulation
 */
@@ -52,6 +100,7 @@ public:
     int delay;
     TaskType taskType;
     std::function<bool()> func;
+    ComponentTask componentTask;
 
     TaskItem(int agentId, int priority, int cycleTime, int delay, TaskType taskType, std::function<bool()> func) :
         agentId(agentId),
@@ -62,8 +111,29 @@ public:
         func(func)
     {
     }
+
+    TaskItem(int agentId, int priority, int cycleTime, int delay, TaskType taskType, ComponentTask componentTask) :
+        agentId(agentId),
+        priority(priority),
+        cycletime(cycleTime),
+        delay(delay),
+        taskType(taskType),
+        componentTask(componentTask)
+    {
+    }
     virtual ~TaskItem() = default;
 
+    /*!
+    * \brief Execute
+    *
+    * @param[in]     int     current simulation time
+    * @return                false, if the task reports error
+    */
+    bool Execute(int time) const
+    {
+        return componentTask.component ? componentTask.Execute(time) : func();
+    }
+
     static constexpr int VALID_FOR_ALL_AGENTS = -1;
     static constexpr int NO_DELAY = 0;
 
@@ -90,6 +160,11 @@ public:
         TaskItem(agentId, priority, cycleTime, delay, TaskType::Trigger, task)
     {
     }
+
+    TriggerTaskItem(int agentId, int priority, int cycleTime, int delay, ComponentTask task) :
+        TaskItem(agentId, priority, cycleTime, delay, TaskType::Trigger, task)
+    {
+    }
 };
 
 //-----------------------------------------------------------------------------
@@ -103,6 +178,11 @@ public:
         TaskItem(agentId, priority, cycleTime, delay, TaskType::Update, task)
     {
     }
+
+    UpdateTaskItem(int agentId, int priority, int cycleTime, int delay, ComponentTask task) :
+        TaskItem(agentId, priority, cycleTime, delay, TaskType::Update, task)
+    {
+    }
 };
 
 //-----------------------------------------------------------------------------
@@ -185,6 +265,11 @@ public:
 
 //-----------------------------------------------------------------------------
 /** \brief stores taskItems in multiset
+*   \details Additionally the tasks are grouped by their schedule (cycletime and
+*            delay) and indexed by agent id. As all tasks of a schedule are due
+*            at the same timestamps, the due tasks are retrieved by checking each
+*            schedule once instead of each task, and removing the tasks of an
+*            agent only touches the tasks of this agent.
 *
 *   \ingroup opSimulation
 */
@@ -193,6 +278,15 @@ public:
 class Tasks
 {
 public:
+    Tasks() = default;
+    Tasks(const Tasks &) = delete;
+    Tasks(Tasks &&) = default;
+    Tasks &operator=(const Tasks &) = delete;
+    Tasks &operator=(Tasks &&) = default;
+
+    //! cycletime and delay of a task
+    using Schedule = std::pair<int, int>;
+
     /*!
     * \brief AddTask
     *
@@ -213,7 +307,83 @@ public:
     */
     void DeleteTasks(int agentId);
 
+    /*!
+    * \brief Clear
+    *
+    * \details removes all tasks
+    */
+    void Clear();
+
+    /*!
+    * \brief GetDueTasks
+    *
+    * \details appends all tasks, which are due at the given timestamp, in
+    *          the order of the intern multiset
+    *
+    * @param[in]     int                timestamp
+    * @param[out]    list of TaskItems  due tasks
+    */
+    void GetDueTasks(int timestamp, std::vector<TaskItem> &dueTasks) const;
+
+    /*!
+    * \brief GetDueTasks
+    *
+    * \details appends pointers to all tasks, which are due at the given timestamp,
+    *          in the order of the intern multiset. The pointers stay valid until
+    *          the tasks are deleted. The merged list is cached, so as long as the
+    *          same schedules are due and no task is added or deleted, it is only
+    *          copied.
+    *
+    * @param[in]     int                        timestamp
+    * @param[out]    list of TaskItem pointers  due tasks
+    */
+    void GetDueTasks(int timestamp, std::vector<const TaskItem *> &dueTasks) const;
+
+    /*!
+    * \brief GetSchedules
+    *
+    * @return    all distinct schedules (cycletime, delay) of the stored tasks
+    */
+    std::vector<Schedule> GetSchedules() const;
+
     std::multiset<TaskItem> tasks;
+
+private:
+    using TaskIterator = std::multiset<TaskItem>::const_iterator;
+
+    //! reference to a stored task, ordered like the intern multiset
+    struct ScheduledTask
+    {
+        int priority;
+        TaskType taskType;
+        std::uint64_t sequence;
+        TaskIterator task;
+
+        bool operator<(const ScheduledTask &rhs) const;
+    };
+
+    using ScheduledTasks = std::set<ScheduledTask>;
+    using ScheduledTasksRange = std::pair<ScheduledTasks::const_iterator, ScheduledTasks::const_iterator>;
+
+    //! collects the schedules due at the given timestamp into dueSchedules and dueScheduleKeys
+    void CollectDueSchedules(int timestamp) const;
+
+    //! calls visit for each task of the collected schedules in the order of the intern multiset
+    template <typename Visitor>
+    void MergeDueSchedules(Visitor &&visit) const;
+
+    std::map<Schedule, ScheduledTasks> schedules;
+    std::unordered_map<int, std::vector<ScheduledTasks::const_iterator>> agentTasks;
+    std::uint64_t nextSequence{0};
+
+    //! reused for each retrieval, so retrieving the due tasks does not allocate
+    mutable std::vector<ScheduledTasksRange> dueSchedules;
+    mutable std::vector<Schedule> dueScheduleKeys;
+
+    //! merged due tasks of cachedDueScheduleKeys, invalidated by adding or deleting tasks
+    mutable std::vector<Schedule> cachedDueScheduleKeys;
+    mutable std::vector<const TaskItem *> cachedDueTasks;
+    mutable bool isDueTasksCacheValid{false};
 };
 
 } // namespace openpass::scheduling
@@ -0,0 +1,101 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "threadSafety.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+
+#include "modelElements/componentType.h"
+
+namespace core {
+
+namespace {
+
+//! libraries sharing static state between all agents and invocations of the process
+constexpr std::array<const char *, 3> NON_THREAD_SAFE_LIBRARIES{"DriverReactionModel", "GlobalObserver", "Sensor_Perception"};
+
+bool IsNonThreadSafe(const std::string &library)
+{
+    return std::any_of(NON_THREAD_SAFE_LIBRARIES.cbegin(), NON_THREAD_SAFE_LIBRARIES.cend(),
+                       [&library](const char *nonThreadSafeLibrary) { return library == nonThreadSafeLibrary; });
+}
+
+//! Returns the non thread safe libraries of the given system config by component id
+std::map<std::string, std::string> GetNonThreadSafeComponents(SystemConfigInterface &systemConfig)
+{
+    std::map<std::string, std::string> nonThreadSafeComponents;
+    for (const auto &[systemId, system] : systemConfig.GetSystems())
+    {
+        for (const auto &[componentId, component] : system->GetComponents())
+        {
+            if (IsNonThreadSafe(component->GetModelLibrary()))
+            {
+                nonThreadSafeComponents.emplace(componentId, component->GetModelLibrary());
+            }
+        }
+    }
+    return nonThreadSafeComponents;
+}
+
+} // namespace
+
+std::optional<std::string> FindNonThreadSafeComponentLibrary(ConfigurationContainerInterface &configurationContainer)
+{
+    for (const auto &[name, systemConfig] : configurationContainer.GetSystemConfigs())
+    {
+        const auto nonThreadSafeComponents = GetNonThreadSafeComponents(*systemConfig);
+        if (!nonThreadSafeComponents.empty())
+        {
+            return nonThreadSafeComponents.cbegin()->second;
+        }
+    }
+
+    const auto systemConfigBlueprint = configurationContainer.GetSystemConfigBlueprint();
+    if (!systemConfigBlueprint || !configurationContainer.GetProfiles())
+    {
+        return std::nullopt;
+    }
+
+    // driver profiles reference the components of the blueprint by id (see DynamicAgentTypeGenerator)
+    const auto nonThreadSafeComponents = GetNonThreadSafeComponents(*systemConfigBlueprint);
+    const auto &profileGroups = configurationContainer.GetProfiles()->GetProfileGroups();
+    const auto driverProfiles = profileGroups.find("Driver");
+    if (nonThreadSafeComponents.empty() || driverProfiles == profileGroups.cend())
+    {
+        return std::nullopt;
+    }
+
+    for (const auto &[profileName, parameters] : driverProfiles->second)
+    {
+        for (const auto &[key, value] : parameters)
+        {
+            const auto parameterValue = std::get_if<openpass::parameter::internal::ParameterValue>(&value);
+            const auto componentId = parameterValue ? std::get_if<std::string>(parameterValue) : nullptr;
+            if (!componentId)
+            {
+                continue;
+            }
+
+            if (const auto component = nonThreadSafeComponents.find(*componentId); component != nonThreadSafeComponents.cend())
+            {
+                return component->second;
+            }
+        }
+    }
+
+    return std::nullopt;
+}
+
+} // namespace core
@@ -0,0 +1,42 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+//-----------------------------------------------------------------------------
+//! @file  threadSafety.h
+//! @brief This file contains the check for component libraries, which must not
+//!        be executed concurrently.
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "include/configurationContainerInterface.h"
+
+namespace core {
+
+//-----------------------------------------------------------------------------
+//! \brief Searches the configured components for a library which keeps process
+//!        wide state (e.g. DReaM components) and therefore supports neither
+//!        concurrently executed agents nor concurrently executed invocations.
+//!
+//! The libraries of all components of the system configs are checked, as well
+//! as the components referenced by the driver profiles.
+//!
+//! \param[in] configurationContainer   imported configurations
+//! \return    name of the first library found, std::nullopt if there is none
+//-----------------------------------------------------------------------------
+std::optional<std::string> FindNonThreadSafeComponentLibrary(ConfigurationContainerInterface &configurationContainer);
+
+} // namespace core
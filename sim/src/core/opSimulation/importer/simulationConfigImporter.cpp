@@ -71,6 +71,24 @@ void SimulationConfigImporter::ImportExperiment(QDomElement experimentElement,
     experimentConfig.randomSeed = static_cast<std::uint32_t>(randomSeed);
 
     experimentConfig.libraries = ImportLibraries(experimentElement);
+
+    if (!ParseInt(experimentElement, "NumberOfThreads", experimentConfig.numberOfThreads))
+    {
+        LOG_INTERN(LogLevel::Info) << "NumberOfThreads undefined, falling back to default value 1";
+        experimentConfig.numberOfThreads = 1;
+    }
+
+    ThrowIfFalse(experimentConfig.numberOfThreads > 0,
+                 experimentElement, "NumberOfThreads must be greater than zero.");
+
+    if (!ParseInt(experimentElement, "NumberOfConcurrentInvocations", experimentConfig.numberOfConcurrentInvocations))
+    {
+        LOG_INTERN(LogLevel::Info) << "NumberOfConcurrentInvocations undefined, falling back to default value 1";
+        experimentConfig.numberOfConcurrentInvocations = 1;
+    }
+
+    ThrowIfFalse(experimentConfig.numberOfConcurrentInvocations > 0,
+                 experimentElement, "NumberOfConcurrentInvocations must be greater than zero.");
 }
 
 void SimulationConfigImporter::ImportScenario(QDomElement scenarioElement,
@@ -263,4 +263,9 @@ void Agent::LinkSchedulerTime(int *const schedulerTime)
     currentTime = schedulerTime;
 }
 
+openpass::publisher::AgentDataPublisher *Agent::GetPublisher() const
+{
+    return publisher.get();
+}
+
 } // namespace core
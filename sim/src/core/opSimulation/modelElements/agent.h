@@ -30,6 +30,10 @@
 class DataBufferWriteInterface;
 class AgentBlueprintInterface;
 
+namespace openpass::publisher {
+class AgentDataPublisher;
+}
+
 namespace core
 {
 
@@ -74,6 +78,9 @@ public:
 
     void LinkSchedulerTime(int* const schedulerTime);
 
+    //! Returns the publisher of this agent (nullptr before instantiation)
+    openpass::publisher::AgentDataPublisher *GetPublisher() const;
+
 private:
     WorldInterface *world = nullptr;
     int id;
@@ -83,7 +90,7 @@ private:
     std::map<std::string, ComponentInterface*> components;
 
     AgentInterface* agentInterface = nullptr;
-    std::unique_ptr<PublisherInterface> publisher;
+    std::unique_ptr<openpass::publisher::AgentDataPublisher> publisher;
 
     int* currentTime = nullptr;
 };
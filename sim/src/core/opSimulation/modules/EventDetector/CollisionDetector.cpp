@@ -15,6 +15,11 @@
 
 #include "CollisionDetector.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
 #include "include/agentInterface.h"
 #include "include/trafficObjectInterface.h"
 #include "include/worldObjectInterface.h"
@@ -39,15 +44,28 @@ CollisionDetector::CollisionDetector(WorldInterface *world,
 
 void CollisionDetector::Trigger(int time)
 {
+    if (agents->empty())
+    {
+        return;
+    }
+
+    // traffic objects do not move, so the grid is only rebuilt if objects were added
+    if (!trafficObjectsIndexed || trafficObjectBounds.size() != trafficObjects->size())
+    {
+        IndexTrafficObjects();
+    }
+
+    UpdateAgentCandidates();
+
     // accumulate collisions
-    for (auto it = agents->cbegin(); it != agents->cend(); ++it)
+    auto candidate = agentCandidates.cbegin();
+    for (size_t index = 0; index < agentList.size(); ++index)
     {
-        AgentInterface *agent = it->second;
-        assert(agent != nullptr);
+        AgentInterface *agent = agentList[index];
 
-        for (auto otherIt = std::next(it); otherIt != agents->cend(); ++otherIt)
+        for (; candidate != agentCandidates.cend() && candidate->first == index; ++candidate)
         {
-            AgentInterface *other = otherIt->second;
+            AgentInterface *other = agentList[candidate->second];
             if (!DetectCollision(other, agent))
             {
                 continue;
@@ -60,14 +78,10 @@ void CollisionDetector::Trigger(int time)
         }
 
         // second loop to avoid comparing traffic objects with traffic objects
-        for (auto trafficObjectIt = trafficObjects->begin(); trafficObjectIt != trafficObjects->end(); ++trafficObjectIt)
+        UpdateTrafficObjectCandidates(agentBounds[index]);
+        for (const auto objectIndex : trafficObjectCandidates)
         {
-            const TrafficObjectInterface *otherObject = *trafficObjectIt;
-            if (!otherObject)
-            {
-                LOG(CbkLogLevel::Warning, "collision detection aborted");
-                throw std::runtime_error("Invalid other worldObject. Collision detection cancled.");
-            }
+            const TrafficObjectInterface *otherObject = (*trafficObjects)[objectIndex];
             if (!DetectCollision(otherObject, agent))
             {
                 continue;
@@ -80,6 +94,154 @@ void CollisionDetector::Trigger(int time)
     }
 }
 
+CollisionDetector::Bounds CollisionDetector::GetBounds(const polygon_t &boundingBox)
+{
+    Bounds bounds{std::numeric_limits<double>::max(),
+                  std::numeric_limits<double>::lowest(),
+                  std::numeric_limits<double>::max(),
+                  std::numeric_limits<double>::lowest()};
+    for (const auto& point : boundingBox.outer())
+    {
+        bounds.minX = std::min(bounds.minX, bg::get<0>(point));
+        bounds.maxX = std::max(bounds.maxX, bg::get<0>(point));
+        bounds.minY = std::min(bounds.minY, bg::get<1>(point));
+        bounds.maxY = std::max(bounds.maxY, bg::get<1>(point));
+    }
+    return bounds;
+}
+
+bool CollisionDetector::Overlap(const Bounds &first, const Bounds &second)
+{
+    return first.maxX >= second.minX && first.minX <= second.maxX &&
+           first.maxY >= second.minY && first.minY <= second.maxY;
+}
+
+std::int64_t CollisionDetector::GetCellIndex(double coordinate)
+{
+    return static_cast<std::int64_t>(std::floor(coordinate / TRAFFIC_OBJECT_CELL_SIZE));
+}
+
+std::int64_t CollisionDetector::GetCellKey(std::int64_t cellX, std::int64_t cellY)
+{
+    return static_cast<std::int64_t>((static_cast<std::uint64_t>(cellX) << 32) ^ static_cast<std::uint32_t>(cellY));
+}
+
+void CollisionDetector::UpdateAgentCandidates()
+{
+    agentList.clear();
+    agentBounds.clear();
+    for (const auto& [id, agent] : *agents)
+    {
+        assert(agent != nullptr);
+        agentList.push_back(agent);
+        agentBounds.push_back(GetBounds(agent->GetBoundingBox2D()));
+    }
+
+    sweepOrder.resize(agentList.size());
+    std::iota(sweepOrder.begin(), sweepOrder.end(), 0);
+    std::sort(sweepOrder.begin(), sweepOrder.end(), [this](size_t first, size_t second)
+    {
+        return agentBounds[first].minX < agentBounds[second].minX;
+    });
+
+    agentCandidates.clear();
+    for (size_t i = 0; i < sweepOrder.size(); ++i)
+    {
+        const auto& bounds = agentBounds[sweepOrder[i]];
+        for (size_t j = i + 1; j < sweepOrder.size() && agentBounds[sweepOrder[j]].minX <= bounds.maxX; ++j)
+        {
+            if (Overlap(bounds, agentBounds[sweepOrder[j]]))
+            {
+                agentCandidates.emplace_back(std::minmax(sweepOrder[i], sweepOrder[j]));
+            }
+        }
+    }
+    std::sort(agentCandidates.begin(), agentCandidates.end());
+}
+
+void CollisionDetector::IndexTrafficObjects()
+{
+    trafficObjectBounds.clear();
+    trafficObjectGrid.clear();
+    largeTrafficObjects.clear();
+
+    for (size_t index = 0; index < trafficObjects->size(); ++index)
+    {
+        const TrafficObjectInterface *trafficObject = (*trafficObjects)[index];
+        if (!trafficObject)
+        {
+            LOG(CbkLogLevel::Warning, "collision detection aborted");
+            throw std::runtime_error("Invalid other worldObject. Collision detection cancled.");
+        }
+
+        const auto bounds = GetBounds(trafficObject->GetBoundingBox2D());
+        trafficObjectBounds.push_back(bounds);
+        if (bounds.minX > bounds.maxX || bounds.minY > bounds.maxY)
+        {
+            continue;
+        }
+
+        const auto minCellX = GetCellIndex(bounds.minX);
+        const auto maxCellX = GetCellIndex(bounds.maxX);
+        const auto minCellY = GetCellIndex(bounds.minY);
+        const auto maxCellY = GetCellIndex(bounds.maxY);
+        if ((maxCellX - minCellX + 1) * (maxCellY - minCellY + 1) > MAX_TRAFFIC_OBJECT_CELLS)
+        {
+            largeTrafficObjects.push_back(index);
+            continue;
+        }
+
+        for (auto cellX = minCellX; cellX <= maxCellX; ++cellX)
+        {
+            for (auto cellY = minCellY; cellY <= maxCellY; ++cellY)
+            {
+                trafficObjectGrid[GetCellKey(cellX, cellY)].push_back(index);
+            }
+        }
+    }
+
+    trafficObjectsIndexed = true;
+}
+
+void CollisionDetector::UpdateTrafficObjectCandidates(const Bounds &bounds)
+{
+    trafficObjectCandidates.clear();
+    if (bounds.minX > bounds.maxX || bounds.minY > bounds.maxY)
+    {
+        return;
+    }
+
+    for (auto cellX = GetCellIndex(bounds.minX); cellX <= GetCellIndex(bounds.maxX); ++cellX)
+    {
+        for (auto cellY = GetCellIndex(bounds.minY); cellY <= GetCellIndex(bounds.maxY); ++cellY)
+        {
+            const auto cell = trafficObjectGrid.find(GetCellKey(cellX, cellY));
+            if (cell == trafficObjectGrid.cend())
+            {
+                continue;
+            }
+            for (const auto index : cell->second)
+            {
+                if (Overlap(bounds, trafficObjectBounds[index]))
+                {
+                    trafficObjectCandidates.push_back(index);
+                }
+            }
+        }
+    }
+    for (const auto index : largeTrafficObjects)
+    {
+        if (Overlap(bounds, trafficObjectBounds[index]))
+        {
+            trafficObjectCandidates.push_back(index);
+        }
+    }
+
+    // objects covering several cells are found more than once
+    std::sort(trafficObjectCandidates.begin(), trafficObjectCandidates.end());
+    trafficObjectCandidates.erase(std::unique(trafficObjectCandidates.begin(), trafficObjectCandidates.end()), trafficObjectCandidates.end());
+}
+
 template <typename T>
 bool IsInVector(const std::vector<T> &v, T element)
 {
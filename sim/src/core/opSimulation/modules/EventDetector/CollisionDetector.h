@@ -19,6 +19,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "EventDetectorCommonBase.h"
 
 #include "common/boostGeometryCommon.h"
@@ -71,6 +76,10 @@ static const double ROTATION_EPS = 0.0001;
 *   \details This class detects wether an agent collided with either another agent
 *   or a traffic object. In case a collision happend an event is created.
 *
+*   Only pairs with overlapping axis aligned bounding boxes are tested exactly.
+*   Agent pairs are found by sweep and prune along the x axis each cycle, the
+*   stationary traffic objects are indexed once in a uniform grid.
+*
 * 	\ingroup EventDetector */
 //-----------------------------------------------------------------------------
 class CollisionDetector : public EventDetectorCommonBase
@@ -108,6 +117,58 @@ public:
     const std::vector<const TrafficObjectInterface*> *trafficObjects = nullptr;
 
 private:
+    //! Axis aligned bounding box of a world object
+    struct Bounds
+    {
+        double minX;
+        double maxX;
+        double minY;
+        double maxY;
+    };
+
+    //! Edge length of the grid cells of the traffic object index
+    static constexpr double TRAFFIC_OBJECT_CELL_SIZE = 20.0;
+
+    //! Traffic objects covering more cells are not put into the grid but tested against every agent
+    static constexpr std::int64_t MAX_TRAFFIC_OBJECT_CELLS = 1024;
+
+    //-----------------------------------------------------------------------------
+    /*! Calculates the axis aligned bounding box of a polygon
+    *
+    * @param[in]  boundingBox    bounding box polygon of a world object
+    *
+    * @return                    minimum and maximum coordinates of the outer points */
+    //-----------------------------------------------------------------------------
+    static Bounds GetBounds(const polygon_t &boundingBox);
+
+    //! Returns true if the boxes overlap or touch (same criterion as CommonHelper::GetCartesianNetDistance)
+    static bool Overlap(const Bounds &first, const Bounds &second);
+
+    static std::int64_t GetCellIndex(double coordinate);
+    static std::int64_t GetCellKey(std::int64_t cellX, std::int64_t cellY);
+
+    //-----------------------------------------------------------------------------
+    /*! Collects the bounding boxes of all agents and the pairs of agents whose boxes
+    *   overlap. The pairs refer to the position of the agents in the agent map and are
+    *   sorted, so events are created in the same order as by testing all pairs. */
+    //-----------------------------------------------------------------------------
+    void UpdateAgentCandidates();
+
+    //-----------------------------------------------------------------------------
+    /*! Builds the grid of the traffic objects.
+    *
+    * @throws std::runtime_error if a traffic object is invalid */
+    //-----------------------------------------------------------------------------
+    void IndexTrafficObjects();
+
+    //-----------------------------------------------------------------------------
+    /*! Collects the traffic objects whose bounding boxes overlap the given one,
+    *   sorted by their position in the traffic object list.
+    *
+    * @param[in]  bounds         bounding box of an agent */
+    //-----------------------------------------------------------------------------
+    void UpdateTrafficObjectCandidates(const Bounds &bounds);
+
     //-----------------------------------------------------------------------------
     /*! Creates a CollisionEvent and inserts it into the event network
     *
@@ -129,6 +190,17 @@ private:
     void DetectedCollisionWithAgent(int time,
                                     AgentInterface *agent,
                                     AgentInterface *other);
+
+    std::vector<AgentInterface*> agentList;
+    std::vector<Bounds> agentBounds;
+    std::vector<size_t> sweepOrder;
+    std::vector<std::pair<size_t, size_t>> agentCandidates;
+
+    bool trafficObjectsIndexed = false;
+    std::vector<Bounds> trafficObjectBounds;
+    std::unordered_map<std::int64_t, std::vector<size_t>> trafficObjectGrid;
+    std::vector<size_t> largeTrafficObjects;
+    std::vector<size_t> trafficObjectCandidates;
 };
 
 
@@ -14,17 +14,173 @@
 
 #include "observationCyclics.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include "common/openPassUtils.h"
+
+namespace {
+
+//! Restores the arithmetic value of the given FlatParameterValue alternative from its bit pattern
+//! and converts it like openpass::utils::FlatParameter::to_string
+template <std::size_t Index = 0>
+std::string FormatScalar(std::size_t valueType, std::uint64_t bits)
+{
+    if constexpr (Index < std::variant_size_v<openpass::databuffer::Value>)
+    {
+        using T = std::variant_alternative_t<Index, openpass::databuffer::Value>;
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            if (valueType == Index)
+            {
+                T value;
+                std::memcpy(&value, &bits, sizeof(T));
+                return std::to_string(value);
+            }
+        }
+        return FormatScalar<Index + 1>(valueType, bits);
+    }
+    else
+    {
+        return "";
+    }
+}
+
+bool IsScalar(const openpass::databuffer::Value &value)
+{
+    return std::visit([](const auto &element)
+    {
+        return std::is_arithmetic_v<std::decay_t<decltype(element)>>;
+    }, value);
+}
+
+bool IsEmptyVector(const openpass::databuffer::Value &value)
+{
+    return std::visit([](const auto &element)
+    {
+        using T = std::decay_t<decltype(element)>;
+        if constexpr (std::is_arithmetic_v<T> || std::is_same_v<T, std::string>)
+        {
+            return false;
+        }
+        else
+        {
+            return element.empty();
+        }
+    }, value);
+}
+
+std::uint64_t ToBits(const openpass::databuffer::Value &value)
+{
+    return std::visit([](const auto &element)
+    {
+        std::uint64_t bits{0};
+        if constexpr (std::is_arithmetic_v<std::decay_t<decltype(element)>>)
+        {
+            std::memcpy(&bits, &element, sizeof(element));
+        }
+        return bits;
+    }, value);
+}
+
+template <typename T>
+void WriteBinary(std::fstream &file, T value)
+{
+    file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+T ReadBinary(std::fstream &file)
+{
+    T value{};
+    file.read(reinterpret_cast<char *>(&value), sizeof(T));
+    return value;
+}
+
+} // namespace
+
+ObservationCyclics::~ObservationCyclics()
+{
+    if (writerThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(writerMutex);
+            stopWriter = true;
+        }
+        writerCondition.notify_all();
+        writerThread.join();
+
+        streamFile.close();
+        std::remove(streamPath.c_str());
+    }
+}
+
+void ObservationCyclics::EnableStreaming(const std::string &path)
+{
+    if (streaming)
+    {
+        return;
+    }
+
+    streamPath = path;
+    OpenStreamFile();
+    streaming = true;
+    writerThread = std::thread(&ObservationCyclics::WriterLoop, this);
+}
+
+void ObservationCyclics::OpenStreamFile()
+{
+    streamFile.close();
+    streamFile.clear();
+    streamFile.open(streamPath, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!streamFile.is_open())
+    {
+        throw std::runtime_error("ObservationCyclics could not create file: " + streamPath);
+    }
+}
+
+ObservationCyclics::ColumnId ObservationCyclics::GetColumnId(const std::string &key)
+{
+    const auto [it, inserted] = columnIds.emplace(key, static_cast<ColumnId>(columnKeys.size()));
+    if (inserted)
+    {
+        columnKeys.push_back(key);
+    }
+    return it->second;
+}
+
+const std::vector<std::size_t> &ObservationCyclics::GetColumnOrder() const
+{
+    if (!columnOrderValid)
+    {
+        columnOrder.resize(columns.size());
+        std::iota(columnOrder.begin(), columnOrder.end(), 0);
+        std::sort(columnOrder.begin(), columnOrder.end(), [this](std::size_t first, std::size_t second)
+        {
+            return columns[first].name < columns[second].name;
+        });
+        columnOrderValid = true;
+    }
+    return columnOrder;
+}
+
 std::string ObservationCyclics::GetHeader() const
 {
     std::string header;
-    for (auto it = samples.begin(); it != samples.end(); ++it)
+    bool first = true;
+    for (const auto columnIndex : GetColumnOrder())
     {
-        if(it != samples.begin())
+        if (!first)
         {
             header += ", ";
         }
+        first = false;
 
-        header += it->first;
+        header += columns[columnIndex].name;
     }
     return header;
 }
@@ -32,50 +188,364 @@ std::string ObservationCyclics::GetHeader() const
 std::string ObservationCyclics::GetSamplesLine(std::uint32_t timeStepNumber) const
 {
     std::string sampleLine;
-    for (auto it = samples.begin(); it != samples.end(); ++it)
+    bool first = true;
+    for (const auto columnIndex : GetColumnOrder())
     {
-        const std::vector<std::string>& values = it->second;
+        const Column& column = columns[columnIndex];
 
-        if (it != samples.begin())
+        if (!first)
         {
             sampleLine += ", ";
         }
+        first = false;
 
-        // not all channels are sampled until end of simulation time
-        if (timeStepNumber < values.size())
+        // not all channels are sampled from start until end of simulation time
+        if (timeStepNumber >= column.firstTimeStep && timeStepNumber - column.firstTimeStep < column.present.size())
         {
-            sampleLine += values.at(timeStepNumber);
+            sampleLine += FormatValue(column, timeStepNumber - column.firstTimeStep);
         }
     }
 
     return sampleLine;
 }
 
+std::string ObservationCyclics::FormatValue(const Column &column, std::size_t index)
+{
+    if (!column.present[index])
+    {
+        return "";
+    }
+    if (column.formatted)
+    {
+        return column.formattedValues[index];
+    }
+    return FormatScalar(column.valueType, column.scalars[index]);
+}
+
+void ObservationCyclics::ForEachSamplesLine(const std::function<void(int, const std::string &)> &writer)
+{
+    if (!streaming)
+    {
+        std::uint32_t timeStepNumber = 0;
+        for (const auto timeStep : timeSteps)
+        {
+            writer(timeStep, GetSamplesLine(timeStepNumber));
+            ++timeStepNumber;
+        }
+        return;
+    }
+
+    StreamTimeSteps(timeSteps.size());
+    WaitForWriter();
+
+    streamFile.flush();
+    streamFile.seekg(0);
+
+    const auto &order = GetColumnOrder();
+    std::vector<std::size_t> position(columns.size());
+    for (std::size_t index = 0; index < order.size(); ++index)
+    {
+        position[order[index]] = index;
+    }
+
+    std::vector<std::string> values(columns.size());
+    std::string sampleLine;
+    for (const auto timeStep : timeSteps)
+    {
+        const auto numberOfValues = ReadBinary<std::uint32_t>(streamFile);
+        for (std::uint32_t value = 0; value < numberOfValues; ++value)
+        {
+            const auto columnIndex = ReadBinary<std::uint32_t>(streamFile);
+            auto &valueString = values.at(position.at(columnIndex));
+            valueString.resize(ReadBinary<std::uint32_t>(streamFile));
+            streamFile.read(valueString.data(), static_cast<std::streamsize>(valueString.size()));
+        }
+        if (!streamFile)
+        {
+            throw std::runtime_error("ObservationCyclics could not read file: " + streamPath);
+        }
+
+        sampleLine.clear();
+        for (std::size_t index = 0; index < values.size(); ++index)
+        {
+            if (index > 0)
+            {
+                sampleLine += ", ";
+            }
+            sampleLine += values[index];
+            values[index].clear();
+        }
+        writer(timeStep, sampleLine);
+    }
+}
+
+void ObservationCyclics::StreamTimeSteps(std::size_t endTimeStep)
+{
+    if (endTimeStep <= streamedTimeSteps)
+    {
+        return;
+    }
+
+    Chunk chunk{streamedTimeSteps, endTimeStep - streamedTimeSteps, {}};
+    for (std::size_t columnIndex = 0; columnIndex < columns.size(); ++columnIndex)
+    {
+        Column &column = columns[columnIndex];
+        if (column.firstTimeStep >= endTimeStep)
+        {
+            continue;
+        }
+
+        const auto numberOfValues = std::min(column.present.size(), endTimeStep - column.firstTimeStep);
+        if (numberOfValues > 0)
+        {
+            Column streamedColumn;
+            streamedColumn.valueType = column.valueType;
+            streamedColumn.formatted = column.formatted;
+            streamedColumn.firstTimeStep = column.firstTimeStep;
+
+            if (numberOfValues == column.present.size())
+            {
+                streamedColumn.present = std::move(column.present);
+                streamedColumn.scalars = std::move(column.scalars);
+                streamedColumn.formattedValues = std::move(column.formattedValues);
+                column.present.clear();
+                column.scalars.clear();
+                column.formattedValues.clear();
+            }
+            else
+            {
+                const auto split = static_cast<std::ptrdiff_t>(numberOfValues);
+                streamedColumn.present.assign(column.present.begin(), column.present.begin() + split);
+                column.present.erase(column.present.begin(), column.present.begin() + split);
+                if (column.formatted)
+                {
+                    streamedColumn.formattedValues.assign(std::make_move_iterator(column.formattedValues.begin()),
+                                                          std::make_move_iterator(column.formattedValues.begin() + split));
+                    column.formattedValues.erase(column.formattedValues.begin(), column.formattedValues.begin() + split);
+                }
+                else
+                {
+                    streamedColumn.scalars.assign(column.scalars.begin(), column.scalars.begin() + split);
+                    column.scalars.erase(column.scalars.begin(), column.scalars.begin() + split);
+                }
+            }
+
+            chunk.columns.emplace_back(columnIndex, std::move(streamedColumn));
+        }
+
+        // the remaining values start at the first timestep which is not streamed
+        column.firstTimeStep = endTimeStep;
+    }
+
+    std::unique_lock<std::mutex> lock(writerMutex);
+    writerCondition.wait(lock, [this] { return !pendingChunk || writerException; });
+    if (writerException)
+    {
+        std::rethrow_exception(std::exchange(writerException, nullptr));
+    }
+    pendingChunk = std::move(chunk);
+    streamedTimeSteps = endTimeStep;
+    lock.unlock();
+    writerCondition.notify_all();
+}
+
+void ObservationCyclics::WaitForWriter()
+{
+    std::unique_lock<std::mutex> lock(writerMutex);
+    writerCondition.wait(lock, [this] { return (!pendingChunk && !writerBusy) || writerException; });
+    if (writerException)
+    {
+        std::rethrow_exception(std::exchange(writerException, nullptr));
+    }
+}
+
+void ObservationCyclics::WriterLoop()
+{
+    std::unique_lock<std::mutex> lock(writerMutex);
+    while (true)
+    {
+        writerCondition.wait(lock, [this] { return stopWriter || pendingChunk; });
+        if (!pendingChunk)
+        {
+            return;
+        }
+
+        const Chunk chunk = std::move(*pendingChunk);
+        pendingChunk.reset();
+        writerBusy = true;
+        lock.unlock();
+        writerCondition.notify_all();
+
+        std::exception_ptr exception;
+        try
+        {
+            WriteChunk(chunk);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        lock.lock();
+        writerBusy = false;
+        if (exception && !writerException)
+        {
+            writerException = exception;
+        }
+        writerCondition.notify_all();
+    }
+}
+
+void ObservationCyclics::WriteChunk(const Chunk &chunk)
+{
+    std::vector<std::pair<std::uint32_t, std::string>> values;
+    for (auto timeStep = chunk.firstTimeStep; timeStep < chunk.firstTimeStep + chunk.numberOfTimeSteps; ++timeStep)
+    {
+        values.clear();
+        for (const auto &[columnIndex, column] : chunk.columns)
+        {
+            if (timeStep >= column.firstTimeStep && timeStep - column.firstTimeStep < column.present.size() &&
+                column.present[timeStep - column.firstTimeStep])
+            {
+                values.emplace_back(static_cast<std::uint32_t>(columnIndex), FormatValue(column, timeStep - column.firstTimeStep));
+            }
+        }
+
+        WriteBinary(streamFile, static_cast<std::uint32_t>(values.size()));
+        for (const auto &[columnIndex, value] : values)
+        {
+            WriteBinary(streamFile, columnIndex);
+            WriteBinary(streamFile, static_cast<std::uint32_t>(value.size()));
+            streamFile.write(value.data(), static_cast<std::streamsize>(value.size()));
+        }
+    }
+
+    if (!streamFile)
+    {
+        throw std::runtime_error("ObservationCyclics could not write file: " + streamPath);
+    }
+}
+
 void ObservationCyclics::Clear()
 {
+    if (streaming)
+    {
+        WaitForWriter();
+        OpenStreamFile();
+        streamedTimeSteps = 0;
+    }
+
     timeSteps.clear();
-    samples.clear();
+    columns.clear();
+    entityColumns.clear();
+    namedColumns.clear();
+    columnOrder.clear();
+    columnOrderValid = true;
+}
+
+void ObservationCyclics::AddTimeStep(int time)
+{
+    timeSteps.insert(timeSteps.end(), time);
+
+    // the new timestep has no values yet, so all previous ones are complete
+    if (streaming && timeSteps.size() - 1 - streamedTimeSteps >= STREAMING_CHUNK_SIZE)
+    {
+        StreamTimeSteps(timeSteps.size() - 1);
+    }
+}
+
+std::size_t ObservationCyclics::AddColumn(std::string name)
+{
+    Column column;
+    column.name = std::move(name);
+    column.valueType = 0;
+    column.firstTimeStep = timeSteps.size() - 1;
+    columns.push_back(std::move(column));
+    columnOrderValid = false;
+    return columns.size() - 1;
+}
+
+void ObservationCyclics::InsertValue(Column &column, const openpass::databuffer::Value &value)
+{
+    const bool scalar = IsScalar(value);
+
+    if (column.present.empty())
+    {
+        column.valueType = value.index();
+        column.formatted = !scalar;
+    }
+    else if (!column.formatted && (!scalar || value.index() != column.valueType))
+    {
+        // the type of the key changed, keep the values as strings from now on
+        column.formattedValues.reserve(column.present.size());
+        for (std::size_t index = 0; index < column.present.size(); ++index)
+        {
+            column.formattedValues.push_back(FormatValue(column, index));
+        }
+        column.scalars.clear();
+        column.scalars.shrink_to_fit();
+        column.formatted = true;
+    }
+
+    // fill up skipped time steps (e.g. another agent has been instantiated in between -> inserted new time step in scheduling)
+    const auto index = timeSteps.size() - 1 - column.firstTimeStep;
+    if (index >= column.present.size())
+    {
+        column.present.resize(index + 1, false);
+        if (column.formatted)
+        {
+            column.formattedValues.resize(index + 1);
+        }
+        else
+        {
+            column.scalars.resize(index + 1);
+        }
+    }
+
+    column.present[index] = true;
+    if (column.formatted)
+    {
+        column.formattedValues[index] = std::visit(openpass::utils::FlatParameter::to_string(), value);
+    }
+    else
+    {
+        column.scalars[index] = ToBits(value);
+    }
 }
 
 //-----------------------------------------------------------------------------
 //! Called by Observation Log Implementation
 //! to log all Sample values in output.xml
 //-----------------------------------------------------------------------------
-void ObservationCyclics::Insert(int time, const std::string &key, const std::string &value)
+void ObservationCyclics::Insert(int time, openpass::type::EntityId entityId, ColumnId columnId, const openpass::databuffer::Value &value)
 {
-    timeSteps.insert(timeSteps.end(), time);
+    if (IsEmptyVector(value))
+    {
+        return;
+    }
 
-    auto it = samples.find(key);
+    AddTimeStep(time);
 
-    if (it == samples.end())
+    const auto columnKey = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(entityId.value)) << 32) | columnId;
+    auto it = entityColumns.find(columnKey);
+    if (it == entityColumns.end())
     {
-        auto [newIt, newElement] = samples.emplace(key, timeSteps.size() - 1);
-        newIt->second.push_back(value);
+        const int id = entityId.value;
+        it = entityColumns.emplace(columnKey, AddColumn((id < 10 ? "0" : "") + std::to_string(id) + ":" + columnKeys.at(columnId))).first;
     }
-    else
+
+    InsertValue(columns[it->second], value);
+}
+
+void ObservationCyclics::Insert(int time, const std::string &key, const std::string &value)
+{
+    AddTimeStep(time);
+
+    auto it = namedColumns.find(key);
+    if (it == namedColumns.end())
     {
-        // fill up skipped time steps (e.g. another agent has been instantiated in between -> inserted new time step in scheduling)
-        it->second.resize(timeSteps.size() - 1);
-        it->second.push_back(value);
+        it = namedColumns.emplace(key, AddColumn(key)).first;
     }
+
+    InsertValue(columns[it->second], value);
 }
@@ -11,17 +11,41 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <set>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
+#include "include/dataBufferInterface.h"
 #include "include/eventNetworkInterface.h"
 
 //!
 //! \brief The ObservationCyclics stores the samples which are logged by various modules
 //! and written into the cyclics tag of the simulationOutput.xml
 //!
+//! The samples are stored column wise. A column holds the values of one key of one entity
+//! in their original type, they are only converted to strings when the output is written.
+//! Keys are interned into column ids, which stay valid for all runs.
+//!
+//! Optionally, completed timesteps are streamed in chunks to a temporary file by a background
+//! thread, so the memory needed does not grow with the length of a run.
+//!
 class ObservationCyclics
 {
 public:
+    using ColumnId = std::uint32_t;
+
+    //! Number of completed timesteps which are handed to the writer thread at once when streaming
+    static constexpr std::size_t STREAMING_CHUNK_SIZE = 100;
+
     ObservationCyclics()
     {
     }
@@ -31,7 +55,24 @@ public:
     ObservationCyclics& operator=(const ObservationCyclics&) = delete;
     ObservationCyclics& operator=(ObservationCyclics&&) = delete;
 
-    ~ObservationCyclics() = default;
+    ~ObservationCyclics();
+
+    /*!
+     * \brief Streams the samples of completed timesteps to a temporary file during the run
+     *
+     * A background thread converts the samples into strings and writes them. At most one chunk
+     * waits for the writer, Insert blocks if the writer falls behind.
+     *
+     * @param[in]     path       Path of the temporary file, it is removed when the cyclics are destroyed
+     */
+    void EnableStreaming(const std::string &path);
+
+    /*!
+     * \brief Returns the id of a DataBuffer key, a new id is assigned on the first call for a key
+     *
+     * @param[in]     key        DataBuffer key (e.g. "XPosition")
+     */
+    ColumnId GetColumnId(const std::string &key);
 
     /*!
     * Inserts a parameter into the samples.
@@ -46,6 +87,18 @@ public:
     */
     void Insert(int time, const std::string &key, const std::string &value);
 
+    /*!
+    * Inserts the value of an entity into the samples. The column is named "<entityId>:<key>",
+    * with the entity id padded to two digits. Missing timesteps are handled like above.
+    * Empty vectors are not inserted.
+    *
+    * @param[in]     time       Timestep in milliseconds.
+    * @param[in]     entityId   Id of the entity (agent or object).
+    * @param[in]     columnId   Id of the DataBuffer key, see GetColumnId.
+    * @param[in]     value      Value of parameter.
+    */
+    void Insert(int time, openpass::type::EntityId entityId, ColumnId columnId, const openpass::databuffer::Value &value);
+
     /*!
      * \brief Returns the string header that is written into the simulationOuput.xml
      */
@@ -53,9 +106,21 @@ public:
 
     /*!
      * \brief Returns a single line of samples for the given timestep for writing into the simulationOutput
+     *
+     * When streaming, only the timesteps which are not yet streamed are available.
      */
     std::string GetSamplesLine(uint32_t timeStepNumber) const;
 
+    /*!
+     * \brief Calls the writer with the time and the line of samples of every timestep
+     *
+     * When streaming, the remaining timesteps are streamed and all lines are read back from the
+     * temporary file, so this may only be called once per run.
+     *
+     * @param[in]     writer     Callable taking the time in milliseconds and the line of samples
+     */
+    void ForEachSamplesLine(const std::function<void(int, const std::string &)> &writer);
+
     /*!
      * \brief Returns all timesteps for which samples exist
      */
@@ -70,8 +135,73 @@ public:
     void Clear();
 
 private:
+    //! Values of one column, missing timesteps are marked in present
+    struct Column
+    {
+        std::string name;                           //!< Header of the column
+        std::size_t valueType;                      //!< Index of the FlatParameterValue alternative of all values of scalars
+        std::size_t firstTimeStep;                  //!< Number of the timestep of the first value
+        std::vector<std::uint64_t> scalars;         //!< Bit patterns of arithmetic values of type valueType
+        std::vector<std::string> formattedValues;   //!< Values of columns with other or mixed types
+        std::vector<bool> present;                  //!< False for timesteps without value
+        bool formatted = false;                     //!< Values are stored in formattedValues
+    };
+
+    //! Adds the time to the timesteps, if it is new, and streams the completed timesteps if a chunk is full
+    void AddTimeStep(int time);
+
+    //! Adds an empty column starting at the current timestep and returns its index
+    std::size_t AddColumn(std::string name);
+
+    //! Sets the value of the column at the current timestep
+    void InsertValue(Column &column, const openpass::databuffer::Value &value);
+
+    //! Converts the value at the index of the column into a string, empty if there is no value
+    static std::string FormatValue(const Column &column, std::size_t index);
+
+    //! Returns the column indices sorted by column name
+    const std::vector<std::size_t> &GetColumnOrder() const;
+
+    //! Samples of completed timesteps which are written by the writer thread
+    struct Chunk
+    {
+        std::size_t firstTimeStep;
+        std::size_t numberOfTimeSteps;
+        std::vector<std::pair<std::size_t, Column>> columns;   //!< Column index and values of the timesteps
+    };
+
+    //! Moves the samples of all timesteps before endTimeStep, which are not streamed yet, to the writer thread
+    void StreamTimeSteps(std::size_t endTimeStep);
+
+    //! Waits until the writer thread has written all chunks and rethrows its exception, if any
+    void WaitForWriter();
+
+    void WriterLoop();
+    void WriteChunk(const Chunk &chunk);
+    void OpenStreamFile();
+
     std::set<int> timeSteps;
-    std::map<std::string, std::vector<std::string>> samples;
-};
 
+    std::unordered_map<std::string, ColumnId> columnIds;
+    std::vector<std::string> columnKeys;
 
+    std::vector<Column> columns;
+    std::unordered_map<std::uint64_t, std::size_t> entityColumns;
+    std::unordered_map<std::string, std::size_t> namedColumns;
+
+    mutable std::vector<std::size_t> columnOrder;
+    mutable bool columnOrderValid = true;
+
+    bool streaming = false;
+    std::string streamPath;
+    std::fstream streamFile;                     //!< Only accessed by the writer thread while it is busy
+    std::size_t streamedTimeSteps = 0;
+
+    std::thread writerThread;
+    std::mutex writerMutex;
+    std::condition_variable writerCondition;
+    std::optional<Chunk> pendingChunk;
+    bool writerBusy = false;
+    bool stopWriter = false;
+    std::exception_ptr writerException;
+};
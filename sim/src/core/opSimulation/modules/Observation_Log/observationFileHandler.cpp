@@ -277,24 +277,20 @@ void ObservationFileHandler::AddHeader(const ObservationCyclics &cyclics)
     xmlFileStream->writeEndElement();
 }
 
-void ObservationFileHandler::AddSamples(const ObservationCyclics& cyclics)
+void ObservationFileHandler::AddSamples(ObservationCyclics& cyclics)
 {
     // write SamplesTag
     xmlFileStream->writeStartElement(outputTags.SAMPLES);
-    const auto& timeSteps = cyclics.GetTimeSteps();
 
-    unsigned int timeStepNumber = 0;
-    for (const auto timeStep : timeSteps)
+    cyclics.ForEachSamplesLine([this](int timeStep, const std::string& samplesLine)
     {
         xmlFileStream->writeStartElement(outputTags.SAMPLE);
         xmlFileStream->writeAttribute(outputAttributes.TIME, QString::number(timeStep));
-        xmlFileStream->writeCharacters(QString::fromStdString(cyclics.GetSamplesLine(timeStepNumber)));
+        xmlFileStream->writeCharacters(QString::fromStdString(samplesLine));
 
         // close SampleTag
         xmlFileStream->writeEndElement();
-
-        ++timeStepNumber;
-    }
+    });
 
     // close SamplesTag
     xmlFileStream->writeEndElement();
@@ -325,7 +321,7 @@ void ObservationFileHandler::RemoveCsvCyclics(QString directory)
     }
 }
 
-void ObservationFileHandler::WriteCsvCyclics(const QString& filepath, const ObservationCyclics &cyclics)
+void ObservationFileHandler::WriteCsvCyclics(const QString& filepath, ObservationCyclics &cyclics)
 {
     QFile csvFile{filepath};
     if (!csvFile.open(QIODevice::WriteOnly | QIODevice::Text))
@@ -340,13 +336,10 @@ void ObservationFileHandler::WriteCsvCyclics(const QString& filepath, const Obse
 
     stream << "Timestep, " << QString::fromStdString(cyclics.GetHeader()) << '\n';
 
-    const auto& timeSteps = cyclics.GetTimeSteps();
-    unsigned int timeStepNumber = 0;
-    for (const auto timeStep : timeSteps)
+    cyclics.ForEachSamplesLine([&stream](int timeStep, const std::string& samplesLine)
     {
-        stream << QString::number(timeStep) << ", " << QString::fromStdString(cyclics.GetSamplesLine(timeStepNumber)) << '\n';
-        ++timeStepNumber;
-    }
+        stream << QString::number(timeStep) << ", " << QString::fromStdString(samplesLine) << '\n';
+    });
 
     csvFile.flush();
 
@@ -185,7 +185,7 @@ protected:
     *
     * @param[in]     cyclics    cyclics of the run
     */
-    void AddSamples(const ObservationCyclics& cyclics);
+    void AddSamples(ObservationCyclics& cyclics);
 
     /*!
     * \brief Writes the filename for the cyclics file into the simulation output during full logging.
@@ -207,7 +207,7 @@ protected:
     * @param[in]    filepath            Filepath for current run
     * @param[in]    cyclics             Cyclics of the current run
     */
-    void WriteCsvCyclics(const QString &filepath, const ObservationCyclics &cyclics);
+    void WriteCsvCyclics(const QString &filepath, ObservationCyclics &cyclics);
 
     /*!
     * \brief Write entities to XML
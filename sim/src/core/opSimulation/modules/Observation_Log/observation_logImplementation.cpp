@@ -113,9 +113,52 @@ void ObservationLogImplementation::OpSimulationPreHook()
         LOG(CbkLogLevel::Error, "No LoggingGroups configured");
     }
 
+    // the ids of the selected keys are assigned once and stay valid for all runs
+    for (const auto& column : selectedColumns)
+    {
+        columnSelection.emplace(column, cyclics.GetColumnId(column));
+    }
+
     fileHandler.SetOutputLocation(runtimeInformation.directories.output, filename);
     fileHandler.SetSceneryFile(std::get<std::string>(dataBuffer->GetStatic("SceneryFile").at(0)));
     fileHandler.WriteStartOfFile(runtimeInformation.versions.framework.str());
+
+    const auto& boolParameters = GetParameters()->GetParametersBool();
+    const auto streamCyclics = boolParameters.find("StreamCyclics");
+    if (streamCyclics != boolParameters.cend() && streamCyclics->second)
+    {
+        cyclics.EnableStreaming(runtimeInformation.directories.output + "/" + filename + ".cyclics.tmp");
+    }
+}
+
+bool ObservationLogImplementation::IsSelected(const std::string& key) const
+{
+    return std::any_of(selectedColumns.cbegin(), selectedColumns.cend(),
+                       [&key](const std::string& column)
+                       {
+                           return key == column;
+                       }) ||
+           std::any_of(selectedRegexColumns.cbegin(), selectedRegexColumns.cend(),
+                       [&key](const auto& column)
+                       {
+                           return key.find(column.first) == 0 &&
+                                  key.find(column.second, key.size() - column.second.size()) == key.size() - column.second.size();
+                       });
+}
+
+std::optional<ObservationCyclics::ColumnId> ObservationLogImplementation::GetSelectedColumn(const std::string& key)
+{
+    auto it = columnSelection.find(key);
+    if (it == columnSelection.end())
+    {
+        std::optional<ObservationCyclics::ColumnId> columnId;
+        if (IsSelected(key))
+        {
+            columnId = cyclics.GetColumnId(key);
+        }
+        it = columnSelection.emplace(key, columnId).first;
+    }
+    return it->second;
 }
 
 void ObservationLogImplementation::OpSimulationPreRunHook()
@@ -147,23 +190,11 @@ void ObservationLogImplementation::OpSimulationUpdateHook(int time, [[maybe_unus
 
     for (const CyclicRow& dsCyclic : *dsCyclics)
     {
-        std::visit(openpass::utils::FlatParameter::to_string([this, &dsCyclic, &time](const std::string& valueStr)
+        if (const auto columnId = GetSelectedColumn(dsCyclic.key))
         {
-            if (std::any_of(selectedColumns.cbegin(), selectedColumns.cend(),
-                            [&dsCyclic](const std::string& column)
-                            {
-                                return dsCyclic.key == column;
-                            }) ||
-                std::any_of(selectedRegexColumns.cbegin(), selectedRegexColumns.cend(),
-                            [&dsCyclic](const auto& column)
-                            {
-                                return dsCyclic.key.find(column.first) == 0 &&
-                                       dsCyclic.key.find(column.second, dsCyclic.key.size() - column.second.size()) == dsCyclic.key.size() - column.second.size();
-                            }))
-            {
-                cyclics.Insert(time, (dsCyclic.entityId < 10 ? "0" : "") + std::to_string(dsCyclic.entityId) + ":" + dsCyclic.key, valueStr);
-            }
-        }), dsCyclic.value);
+            // values are stored in their original type and formatted when the run is written
+            cyclics.Insert(time, dsCyclic.entityId, *columnId, dsCyclic.value);
+        }
     }
 
     ReadIfSet("TotalDistanceTraveled", dataBuffer, runStatistic.distanceTraveled);
@@ -19,9 +19,11 @@
 
 #pragma once
 
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <regex>
 
 #include <QFile>
@@ -78,6 +80,20 @@ public:
     }
 
 private:
+    //! Returns true if the DataBuffer key matches a column of the configured LoggingGroups
+    bool IsSelected(const std::string& key) const;
+
+    //-----------------------------------------------------------------------------
+    /*! Returns the column id of a DataBuffer key if it is logged.
+    *   The LoggingGroups are only evaluated the first time a key is seen,
+    *   the result is kept for all further rows and runs.
+    *
+    * @param[in]  key            DataBuffer key of a cyclic row
+    *
+    * @return                    column id or std::nullopt if the key is not logged */
+    //-----------------------------------------------------------------------------
+    std::optional<ObservationCyclics::ColumnId> GetSelectedColumn(const std::string& key);
+
     const openpass::common::RuntimeInformation& runtimeInformation;
     core::EventNetworkInterface* eventNetwork;
     DataBufferReadInterface* dataBuffer;
@@ -87,6 +103,7 @@ private:
     RunStatistic runStatistic = RunStatistic(-1);
     std::vector<std::string> selectedColumns;
     std::vector<std::pair<std::string,std::string>> selectedRegexColumns;
+    std::unordered_map<std::string, std::optional<ObservationCyclics::ColumnId>> columnSelection;
 };
 
 
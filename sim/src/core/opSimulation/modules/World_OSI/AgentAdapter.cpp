@@ -12,6 +12,7 @@
  ********************************************************************************/
 
 #include <cassert>
+#include <cmath>
 #include <algorithm>
 #include "AgentAdapter.h"
 #include "common/globalDefinitions.h"
@@ -22,14 +23,16 @@ AgentAdapter::AgentAdapter(const openpass::type::EntityId id,
                            WorldInterface* world,
                            const CallbackInterface* callbacks,
                            OWL::Interfaces::WorldData* worldData,
-                           const World::Localization::Localizer& localizer) :
+                           const World::Localization::Localizer& localizer,
+                           double poseChangeEpsilon) :
     id{static_cast<int>(id.value)},
     WorldObjectAdapter{worldData->AddMovingObject(id.value, static_cast<void*>(static_cast<WorldObjectInterface*>(this)))},
     world{world},
     callbacks{callbacks},
     worldData{worldData},
     localizer{localizer},
-    egoAgent{this, world}
+    egoAgent{this, world},
+    poseChangeEpsilon{poseChangeEpsilon}
 {
 }
 
@@ -77,6 +80,7 @@ void AgentAdapter::InitParameter(const AgentBlueprintInterface& agentBlueprint)
     // spawn tasks are executed before any other task types within current scheduling time
     // other task types will have a consistent view of the world
     // calculate initial position
+    UpdateBoundingBox();
     Locate();
 
     auto& route = spawnParameter.route;
@@ -85,15 +89,33 @@ void AgentAdapter::InitParameter(const AgentBlueprintInterface& agentBlueprint)
 
 bool AgentAdapter::Update()
 {
-    // currently set to constant true to correctly update BB of rotating objects (with velocity = 0)
+    PrepareUpdate();
+    return CompleteUpdate();
+}
+
+void AgentAdapter::PrepareUpdate()
+{
+    // always recalculated to correctly update BB of rotating objects (with velocity = 0)
     // and objects with an incomplete set of dynamic parameters (i. e. changing x/y with velocity = 0)
-    //boundingBoxNeedsUpdate = std::abs(GetVelocity()) >= zeroBaseline;
-    boundingBoxNeedsUpdate = true;
-    if(!Locate())
+    // not calculated lazily, because other agents may query it concurrently
+    UpdateBoundingBox();
+
+    isLaneAssignmentPending = HasMovedSinceLocate();
+    if (isLaneAssignmentPending)
+    {
+        LocateWithoutAssignment();
+    }
+}
+
+bool AgentAdapter::CompleteUpdate()
+{
+    if (isLaneAssignmentPending)
     {
-        return false;
+        Unlocate();
+        localizer.Assign(GetBaseTrafficObject(), locateResult);
+        isLaneAssignmentPending = false;
     }
-    return true;
+    return locateResult.isOnRoute;
 }
 
 void AgentAdapter::SetBrakeLight(bool brakeLightStatus)
@@ -107,22 +129,47 @@ bool AgentAdapter::GetBrakeLight() const
 }
 
 bool AgentAdapter::Locate()
+{
+    LocateWithoutAssignment();
+    Unlocate();
+    localizer.Assign(GetBaseTrafficObject(), locateResult);
+
+    return locateResult.isOnRoute;
+}
+
+void AgentAdapter::LocateWithoutAssignment()
 {
     // reset on-demand values
     boundaryPoints.clear();
 
-    locateResult = localizer.Locate(GetBoundingBox2D(), GetBaseTrafficObject());
+    locatedBoundingBox = GetBoundingBox2D();
+    locateResult = localizer.LocateWithoutAssignment(locatedBoundingBox, GetBaseTrafficObject());
 
     GetBaseTrafficObject().SetLocatedPosition(locateResult.position);
 
     egoAgent.Update();
+}
 
-    return locateResult.isOnRoute;
+bool AgentAdapter::HasMovedSinceLocate() const
+{
+    const auto& corners = GetBoundingBox2D().outer();
+    const auto& locatedCorners = locatedBoundingBox.outer();
+    if (corners.size() != locatedCorners.size())
+    {
+        return true;
+    }
+
+    return !std::equal(corners.cbegin(), corners.cend(), locatedCorners.cbegin(),
+                       [this](const point_t& corner, const point_t& locatedCorner)
+    {
+        return std::abs(corner.x() - locatedCorner.x()) <= poseChangeEpsilon &&
+               std::abs(corner.y() - locatedCorner.y()) <= poseChangeEpsilon;
+    });
 }
 
 void AgentAdapter::Unlocate()
 {
-    localizer.Unlocate(GetBaseTrafficObject());
+    loc::RemoveLaneAssignments(GetBaseTrafficObject());
 }
 
 AgentCategory AgentAdapter::GetAgentCategory() const
@@ -264,6 +311,7 @@ double AgentAdapter::GetDistanceToConnectorDeparture(std::string intersectingCon
 
 void AgentAdapter::Unregister() const
 {
+    loc::RemoveLaneAssignments(GetBaseTrafficObject());
     worldData->RemoveMovingObjectById(GetBaseTrafficObject().GetId());
 }
 
@@ -49,7 +49,8 @@ public:
                  WorldInterface* world,
                  const CallbackInterface* callbacks,
                  OWL::Interfaces::WorldData* worldData,
-                 const World::Localization::Localizer& localizer);
+                 const World::Localization::Localizer& localizer,
+                 double poseChangeEpsilon = 0.0);
 
     ~AgentAdapter() override;
 
@@ -449,6 +450,18 @@ public:
 
     bool Update() override;
 
+    //! First part of Update: locates the agent without assigning it to any lane.
+    //! An agent, whose bounding box did not move more than the pose change epsilon since
+    //! its last localization, keeps its position and lane assignments.
+    //! Only modifies this agent, so it may be called for several agents in parallel
+    void PrepareUpdate();
+
+    //! Second part of Update: moves the agent from its previous lanes to the lanes it was located on by PrepareUpdate.
+    //! Modifies the lanes and must therefore not be called in parallel
+    //!
+    //! \return true if the agent is on route
+    bool CompleteUpdate();
+
     void SetBrakeLight(bool brakeLightStatus) override;
 
     bool GetBrakeLight() const override;
@@ -531,6 +544,12 @@ private:
     const World::Localization::Localizer& localizer;
     EgoAgent egoAgent;
 
+    //! Locates the agent and updates its position, but does not assign it to any lane
+    void LocateWithoutAssignment();
+
+    //! Returns true if a corner of the bounding box moved more than the pose change epsilon since the last localization
+    bool HasMovedSinceLocate() const;
+
     OWL::Interfaces::MovingObject& GetBaseTrafficObject()
     {
         return *(static_cast<OWL::Interfaces::MovingObject*>(&baseTrafficObject));
@@ -605,6 +624,9 @@ private:
     double distanceTraveled = 0.0;
 
     World::Localization::Result locateResult;
+    polygon_t locatedBoundingBox;
+    const double poseChangeEpsilon;
+    bool isLaneAssignmentPending = false;
     mutable std::vector<GlobalRoadPosition> boundaryPoints;
 
     std::vector<std::pair<ObjectTypeOSI, int>> collisionPartners;
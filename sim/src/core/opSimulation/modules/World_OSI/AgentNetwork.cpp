@@ -10,7 +10,9 @@
  ********************************************************************************/
 
 #include <algorithm>
+#include <future>
 #include <string>
+#include <thread>
 #include <QFile>
 #include "AgentAdapter.h"
 #include "AgentNetwork.h"
@@ -86,11 +88,13 @@ const AgentInterfaces AgentNetwork::GetRemovedAgentsInPreviousTimestep()
 
 void AgentNetwork::QueueAgentUpdate(std::function<void()> func)
 {
-    updateQueue.push_back(func);
+    std::lock_guard<std::mutex> lock(queueMutex);
+    updateQueue.push_back(std::move(func));
 }
 
 void AgentNetwork::QueueAgentRemove(const AgentInterface* agent)
 {
+    std::lock_guard<std::mutex> lock(queueMutex);
     removeQueue.push_back(agent);
 }
 
@@ -160,13 +164,15 @@ void AgentNetwork::SyncGlobalData()
     removeQueue.clear();
 
     auto currentAgents = agents; //make a copy, because agents is manipulated inside the loop
+    const bool isPrepared = PrepareUpdatesInParallel(currentAgents);
     for (auto& item : currentAgents)
     {
         AgentInterface* agent = item.second;
 
-        agent->Unlocate();
-
-        if (!agent->Update())
+        // lane assignments are always updated in the order of the agent ids
+        // agents remove themselves from their previous lanes, if they have moved
+        const bool isOnRoute = isPrepared ? static_cast<AgentAdapter*>(agent)->CompleteUpdate() : agent->Update();
+        if (!isOnRoute)
         {
             LOG(CbkLogLevel::Warning, "Could not locate agent");
         }
@@ -178,3 +184,49 @@ void AgentNetwork::SyncGlobalData()
         }
     }
 }
+
+bool AgentNetwork::PrepareUpdatesInParallel(const std::map<int, AgentInterface*>& currentAgents) const
+{
+    const auto numberOfThreads = std::min<std::size_t>(std::thread::hardware_concurrency(),
+                                                       currentAgents.size() / MIN_AGENTS_PER_LOCALIZATION_THREAD);
+    if (numberOfThreads < 2)
+    {
+        return false;
+    }
+
+    std::vector<AgentAdapter*> adapters;
+    adapters.reserve(currentAgents.size());
+    for (const auto& [id, agent] : currentAgents)
+    {
+        auto adapter = dynamic_cast<AgentAdapter*>(agent);
+        if (!adapter)
+        {
+            return false;
+        }
+        adapters.push_back(adapter);
+    }
+
+    const auto prepareUpdates = [&adapters](std::size_t begin, std::size_t end)
+    {
+        for (auto index = begin; index < end; ++index)
+        {
+            adapters[index]->PrepareUpdate();
+        }
+    };
+
+    std::vector<std::future<void>> preparations;
+    for (std::size_t thread = 1; thread < numberOfThreads; ++thread)
+    {
+        preparations.push_back(std::async(std::launch::async, prepareUpdates,
+                                          adapters.size() * thread / numberOfThreads,
+                                          adapters.size() * (thread + 1) / numberOfThreads));
+    }
+    prepareUpdates(0, adapters.size() / numberOfThreads);
+
+    for (auto& preparation : preparations)
+    {
+        preparation.get();
+    }
+
+    return true;
+}
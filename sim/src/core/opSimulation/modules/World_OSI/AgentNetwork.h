@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <utility>
 #include <map>
+#include <mutex>
 #include "common/openPassTypes.h"
 #include "include/agentInterface.h"
 #include "AgentAdapter.h"
@@ -63,6 +64,7 @@ public:
      * \brief QueueAgentUpdate
      * This function is used to store operations on the agents in a list.
      * At the end of each time step all queued operations will be executed.
+     * Agents may queue their operations concurrently.
      *
      * \param[in] func      function which is to stored to be executed later
      * \param[in] val       value for the function
@@ -153,12 +155,26 @@ protected:
         }
     }
 
-private:    
+private:
+    //! Minimum number of agents per thread for a parallel localization
+    static constexpr std::size_t MIN_AGENTS_PER_LOCALIZATION_THREAD = 16;
+
+    /*!
+     * \brief PrepareUpdatesInParallel
+     * Localizes the agents concurrently without assigning them to any lane (see AgentAdapter::PrepareUpdate).
+     * The agents are only prepared if there are enough agents for at least two threads and all of them are AgentAdapters.
+     *
+     * \param[in] currentAgents    agents to prepare
+     * \return                     true if the agents were prepared and only need to be completed
+     */
+    bool PrepareUpdatesInParallel(const std::map<int, AgentInterface*>& currentAgents) const;
+
     WorldImplementation *world;
     std::map<int, AgentInterface*> agents;
     AgentInterfaces removedAgents;
     std::vector<std::function<void()>> updateQueue;
     AgentInterfaces removeQueue;
+    std::mutex queueMutex;      //!< guards updateQueue and removeQueue against concurrently executed agents
     AgentInterfaces removedAgentsPrevious;
 
     const CallbackInterface *callbacks;
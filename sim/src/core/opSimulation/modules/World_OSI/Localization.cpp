@@ -169,6 +169,15 @@ void CreateLaneAssignments(OWL::Interfaces::WorldObject& object, const std::map<
     }
 }
 
+void RemoveLaneAssignments(OWL::Interfaces::MovingObject& object)
+{
+    for (const auto lane : object.GetLaneAssignments())
+    {
+        const_cast<OWL::Interfaces::Lane*>(lane)->RemoveMovingObject(object);
+    }
+    object.ClearLaneAssignments();
+}
+
 Result Localizer::BuildResult(const LocatedObject& locatedObject) const
 {
     std::set<int> touchedLaneIds;
@@ -190,7 +199,8 @@ Result Localizer::BuildResult(const LocatedObject& locatedObject) const
     ObjectPosition position{locatedObject.referencePoint, locatedObject.mainLaneLocator, touchedRoads};
 
     Result result(position,
-                  isOnRoute);
+                  isOnRoute,
+                  locatedObject.laneOverlaps);
 
     return result;
 }
@@ -216,6 +226,14 @@ void Localizer::Init()
 }
 
 Result Localizer::Locate(const polygon_t& boundingBox, OWL::Interfaces::WorldObject& object) const
+{
+    auto result = LocateWithoutAssignment(boundingBox, object);
+    Assign(object, result);
+
+    return result;
+}
+
+Result Localizer::LocateWithoutAssignment(const polygon_t& boundingBox, const OWL::Interfaces::WorldObject& object) const
 {
     const auto& referencePointPosition = object.GetReferencePointPosition();
     const auto& orientation = object.GetAbsOrientation();
@@ -246,13 +264,15 @@ Result Localizer::Locate(const polygon_t& boundingBox, OWL::Interfaces::WorldObj
                                                          mainLaneLocator,
                                                          orientation.yaw);
 
-    auto result = BuildResult(locatedObject);
+    return BuildResult(locatedObject);
+}
+
+void Localizer::Assign(OWL::Interfaces::WorldObject& object, const Result& result) const
+{
     if (result.isOnRoute)
     {
-        CreateLaneAssignments(object, locatedObject.laneOverlaps);
+        CreateLaneAssignments(object, result.laneOverlaps);
     }
-
-    return result;
 }
 
 GlobalRoadPositions Localizer::Locate(const Common::Vector2d& point, const double& hdg) const
@@ -32,6 +32,7 @@ class Result
 public:
     ObjectPosition position;
     bool isOnRoute {false};
+    std::map<const OWL::Interfaces::Lane*, OWL::LaneOverlap> laneOverlaps;
 
     static Result Invalid()
     {
@@ -41,9 +42,11 @@ public:
     Result() = default;
 
     Result(ObjectPosition position,
-           bool isOnRoute) :
+           bool isOnRoute,
+           std::map<const OWL::Interfaces::Lane*, OWL::LaneOverlap> laneOverlaps = {}) :
         position{position},
-        isOnRoute{isOnRoute}
+        isOnRoute{isOnRoute},
+        laneOverlaps{std::move(laneOverlaps)}
     {}
 };
 
@@ -93,6 +96,10 @@ polygon_t GetBoundingBox(double x, double y, double length, double width, double
 //! contains this object
 void CreateLaneAssignments(OWL::Interfaces::WorldObject& object, const std::map<const OWL::Interfaces::Lane*, OWL::LaneOverlap>& laneOverlaps);
 
+//! Removes this moving object from all lanes it is assigned to and clears its lane assignments,
+//! so that only the lanes of the object are touched instead of clearing all lanes
+void RemoveLaneAssignments(OWL::Interfaces::MovingObject& object);
+
 class Localizer
 {
 public:
@@ -100,8 +107,24 @@ public:
 
     void Init();
 
+    //! Locates the object and assigns it to the lanes it was located on (see Assign)
     Result Locate(const polygon_t& boundingBox, OWL::Interfaces::WorldObject& object) const;
 
+    //! Locates the object without modifying the object or any lane.
+    //! Only reads the static road network, so it may be called for several objects in parallel
+    //!
+    //! \param boundingBox     bounding box of the object
+    //! \param object          object to locate
+    //! \return                result of the localization including the overlapped lanes
+    Result LocateWithoutAssignment(const polygon_t& boundingBox, const OWL::Interfaces::WorldObject& object) const;
+
+    //! Assigns the object to all lanes of the result, if the object is on route.
+    //! Modifies the lanes and must therefore not be called in parallel
+    //!
+    //! \param object          located object
+    //! \param result          result of LocateWithoutAssignment for this object
+    void Assign(OWL::Interfaces::WorldObject& object, const Result& result) const;
+
     GlobalRoadPositions Locate(const Common::Vector2d& point, const double& hdg) const;
 
     void Unlocate(OWL::Interfaces::WorldObject& object) const;
@@ -14,6 +14,7 @@
 //! @brief This file provides the basic datatypes of the osi world layer (OWL)
 //-----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <exception>
 #include <list>
 #include <memory>
@@ -440,6 +441,11 @@ void Lane::AddTrafficLight(Interfaces::TrafficLight &trafficLight)
     trafficLights.push_back(&trafficLight);
 }
 
+void Lane::RemoveMovingObject(const Interfaces::MovingObject& movingObject)
+{
+    worldObjects.Remove(&movingObject);
+}
+
 void Lane::ClearMovingObjects()
 {
     worldObjects.Clear();
@@ -1796,44 +1802,56 @@ Lane::LaneAssignmentCollector::LaneAssignmentCollector() noexcept
 
 void Lane::LaneAssignmentCollector::Insert(const LaneOverlap& laneOverlap, const OWL::Interfaces::WorldObject* object)
 {
-    downstreamOrderAssignments.emplace_back(laneOverlap, object);
-    upstreamOrderAssignments.emplace_back(laneOverlap, object);
-    dirty = true;
+    const Interfaces::LaneAssignment assignment{laneOverlap, object};
+    downstreamOrderAssignments.insert(std::upper_bound(downstreamOrderAssignments.begin(), downstreamOrderAssignments.end(), assignment, IsDownstreamOrdered),
+                                      assignment);
+    upstreamOrderAssignments.insert(std::upper_bound(upstreamOrderAssignments.begin(), upstreamOrderAssignments.end(), assignment, IsUpstreamOrdered),
+                                    assignment);
+}
+
+void Lane::LaneAssignmentCollector::Remove(const OWL::Interfaces::WorldObject* object)
+{
+    const auto isObject = [object](const auto& assignment){ return assignment.second == object; };
+    downstreamOrderAssignments.erase(std::remove_if(downstreamOrderAssignments.begin(), downstreamOrderAssignments.end(), isObject),
+                                     downstreamOrderAssignments.end());
+    upstreamOrderAssignments.erase(std::remove_if(upstreamOrderAssignments.begin(), upstreamOrderAssignments.end(), isObject),
+                                   upstreamOrderAssignments.end());
 }
 
 void Lane::LaneAssignmentCollector::Clear()
 {
     downstreamOrderAssignments.clear();
     upstreamOrderAssignments.clear();
-    dirty = false;
 }
 
-void Lane::LaneAssignmentCollector::Sort() const
-{  
-    std::sort(downstreamOrderAssignments.begin(), downstreamOrderAssignments.end(),
-              [](const auto& lhs, const auto& rhs)
+bool Lane::LaneAssignmentCollector::IsDownstreamOrdered(const Interfaces::LaneAssignment& lhs, const Interfaces::LaneAssignment& rhs)
+{
+    if (lhs.first.s_min != rhs.first.s_min)
     {
-        return lhs.first.s_min < rhs.first.s_min || 
-               (lhs.first.s_min == rhs.first.s_min && lhs.first.s_max < rhs.first.s_max);
-    });
-
-    std::sort(upstreamOrderAssignments.begin(), upstreamOrderAssignments.end(),
-              [](const auto& lhs, const auto& rhs)
+        return lhs.first.s_min < rhs.first.s_min;
+    }
+    if (lhs.first.s_max != rhs.first.s_max)
     {
-        return lhs.first.s_max > rhs.first.s_max || 
-               (lhs.first.s_max == rhs.first.s_max && lhs.first.s_min > rhs.first.s_min);
-    });
-
-    dirty = false;
+        return lhs.first.s_max < rhs.first.s_max;
+    }
+    return lhs.second->GetId() < rhs.second->GetId();
 }
 
-const Interfaces::LaneAssignments& Lane::LaneAssignmentCollector::Get(bool downstream) const
+bool Lane::LaneAssignmentCollector::IsUpstreamOrdered(const Interfaces::LaneAssignment& lhs, const Interfaces::LaneAssignment& rhs)
 {
-    if(dirty)
+    if (lhs.first.s_max != rhs.first.s_max)
     {
-        Sort();
+        return lhs.first.s_max > rhs.first.s_max;
     }
+    if (lhs.first.s_min != rhs.first.s_min)
+    {
+        return lhs.first.s_min > rhs.first.s_min;
+    }
+    return lhs.second->GetId() < rhs.second->GetId();
+}
 
+const Interfaces::LaneAssignments& Lane::LaneAssignmentCollector::Get(bool downstream) const
+{
     if(downstream)
     {
         return downstreamOrderAssignments;
@@ -304,6 +304,9 @@ public:
     //!Assigns a traffic light to this lane
     virtual void AddTrafficLight (Interfaces::TrafficLight &trafficLight) = 0;
 
+    //!Removes a MovingObject from the list of objects currently in this lane
+    virtual void RemoveMovingObject(const OWL::Interfaces::MovingObject& movingObject) = 0;
+
     //!Removes all MovingObjects from the list of objects currently in this lane while keeping StationaryObjects
     virtual void ClearMovingObjects() = 0;
 };
@@ -879,6 +882,7 @@ public:
     void AddTrafficSign (Interfaces::TrafficSign &trafficSign) override;
     void AddRoadMarking (Interfaces::RoadMarking &roadMarking) override;
     void AddTrafficLight (Interfaces::TrafficLight &trafficLight) override;
+    void RemoveMovingObject(const OWL::Interfaces::MovingObject& movingObject) override;
     void ClearMovingObjects() override;
 
     std::tuple<const Primitive::LaneGeometryJoint*, const Primitive::LaneGeometryJoint*> GetNeighbouringJoints(
@@ -892,6 +896,7 @@ public:
     //! either by their starting coordinate (s_min) or their ending coordinate (s_max).
     //! When looking downstream, objects are sorted ascending by their s_min coordinate.
     //! When looking upstream, objects are sorted descending by their s_max coordinate.
+    //! Objects are inserted at their sorted position, so reading the collections never modifies them.
     class LaneAssignmentCollector
     {
         public:
@@ -902,6 +907,10 @@ public:
             //! @param object      the object
             void Insert(const LaneOverlap& laneOverlap, const Interfaces::WorldObject* object);
 
+            //! @brief Remove all entries of an object, keeping the order of the remaining entries
+            //! @param object      the object
+            void Remove(const Interfaces::WorldObject* object);
+
             //! @brief Get list of LaneAssignements
             //! @param downstream  true for looking "in stream direction", else false
             const Interfaces::LaneAssignments& Get(bool downstream) const;
@@ -909,21 +918,17 @@ public:
             //! @brief Clears the managed collections
             void Clear();
         private:
-            //! @brief Sorts the managed collections using a custom sorter for LaneOverlap
+            //! @brief Custom sorters for LaneOverlap
             //!
             //! The two internal collecions are sorted by the following comparisons:
             //! Ascending: Unless equal, the smaller s_min wins, else the smaller s_max
             //! Descending: Unless equal, the larger s_max wins, else the larger s_min
-            void Sort() const;
+            //! Equal overlaps are ordered by ascending object id in both collections
+            static bool IsDownstreamOrdered(const Interfaces::LaneAssignment& lhs, const Interfaces::LaneAssignment& rhs);
+            static bool IsUpstreamOrdered(const Interfaces::LaneAssignment& lhs, const Interfaces::LaneAssignment& rhs);
 
-            //! @brief  Flag indicating, that collections need sorting
-            //!
-            //! For performance reasons, this class uses lazy sorting, meaning that insertion
-            //! happens unordered and sorting is applied at the very first access of the collections.
-            bool mutable dirty{false};
-            
-            Interfaces::LaneAssignments mutable downstreamOrderAssignments;
-            Interfaces::LaneAssignments mutable upstreamOrderAssignments;
+            Interfaces::LaneAssignments downstreamOrderAssignments;
+            Interfaces::LaneAssignments upstreamOrderAssignments;
 
             static constexpr size_t INITIAL_COLLECTION_SIZE = 32; //!!< Minimum reserved collection size to prevent to many reallocations
     };
@@ -72,6 +72,7 @@ public:
     MOCK_METHOD2(AddStationaryObject,
                  void(OWL::Interfaces::StationaryObject& stationaryObject, const LaneOverlap& laneOverlap));
     MOCK_METHOD2(AddWorldObject, void (OWL::Interfaces::WorldObject& worldObject, const LaneOverlap& laneOverlap));
+    MOCK_METHOD1(RemoveMovingObject, void(const OWL::Interfaces::MovingObject& movingObject));
     MOCK_METHOD0(ClearMovingObjects, void());
 
     MOCK_METHOD1(AddNext,
@@ -32,6 +32,7 @@ TrafficObjectAdapter::TrafficObjectAdapter(const openpass::type::EntityId id,
     baseTrafficObject.SetDimension(dimension);
     baseTrafficObject.SetAbsOrientation(orientation);
     InitLaneDirection(orientation.yaw);
+    UpdateBoundingBox();
     Locate();
 }
 
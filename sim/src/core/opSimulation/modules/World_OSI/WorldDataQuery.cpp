@@ -27,6 +27,13 @@ static const OWL::Interfaces::Lane* GetLaneOnRoad(const OWL::Interfaces::Road* r
 WorldDataQuery::WorldDataQuery(const OWL::Interfaces::WorldData &worldData) : worldData{worldData}
 {}
 
+void WorldDataQuery::ClearMultiStreamCache()
+{
+    std::lock_guard<std::mutex> lock(multiStreamMutex);
+    laneMultiStreams.clear();
+    roadMultiStreams.clear();
+}
+
 template<typename T>
 Stream<T> Stream<T>::Reverse() const
 {
@@ -599,11 +606,26 @@ std::shared_ptr<const LaneMultiStream> WorldDataQuery::CreateLaneMultiStream(con
 {
     const auto& routeElement = get(RouteElement(), roadGraph, start);
     const auto& startLane = GetLaneByOdId(routeElement.roadId, startLaneId, startDistance);
-    if (!startLane.Exists())
+    const OWL::Lane* rootLane = startLane.Exists() ? &startLane : nullptr;
+
+    auto key = std::make_pair(rootLane, GetTopologyKey(roadGraph, start));
+    {
+        std::lock_guard<std::mutex> lock(multiStreamMutex);
+        if (const auto cachedStream = laneMultiStreams.find(key); cachedStream != laneMultiStreams.end())
+        {
+            return cachedStream->second;
+        }
+    }
+
+    auto laneMultiStream = std::make_shared<const LaneMultiStream>(CreateLaneMultiStreamRecursive(roadGraph, start, 0.0, rootLane));
+
+    std::lock_guard<std::mutex> lock(multiStreamMutex);
+    if (laneMultiStreams.size() >= MAX_CACHED_MULTI_STREAMS)
     {
-        return std::make_shared<const LaneMultiStream>(CreateLaneMultiStreamRecursive(roadGraph, start, 0.0, nullptr));
+        laneMultiStreams.clear();
     }
-    return std::make_shared<const LaneMultiStream>(CreateLaneMultiStreamRecursive(roadGraph, start, 0.0, &startLane));
+    laneMultiStreams.emplace(std::move(key), laneMultiStream);
+    return laneMultiStream;
 }
 
 std::unique_ptr<RoadStream> WorldDataQuery::CreateRoadStream(const std::vector<RouteElement>& route) const
@@ -629,7 +651,40 @@ std::unique_ptr<RoadStream> WorldDataQuery::CreateRoadStream(const std::vector<R
 
 std::shared_ptr<const RoadMultiStream> WorldDataQuery::CreateRoadMultiStream(const RoadGraph& roadGraph, RoadGraphVertex start) const
 {
-    return std::make_shared<const RoadMultiStream>(CreateRoadMultiStreamRecursive(roadGraph, start, 0.0));
+    auto key = GetTopologyKey(roadGraph, start);
+    {
+        std::lock_guard<std::mutex> lock(multiStreamMutex);
+        if (const auto cachedStream = roadMultiStreams.find(key); cachedStream != roadMultiStreams.end())
+        {
+            return cachedStream->second;
+        }
+    }
+
+    auto roadMultiStream = std::make_shared<const RoadMultiStream>(CreateRoadMultiStreamRecursive(roadGraph, start, 0.0));
+
+    std::lock_guard<std::mutex> lock(multiStreamMutex);
+    if (roadMultiStreams.size() >= MAX_CACHED_MULTI_STREAMS)
+    {
+        roadMultiStreams.clear();
+    }
+    roadMultiStreams.emplace(std::move(key), roadMultiStream);
+    return roadMultiStream;
+}
+
+WorldDataQuery::TopologyKey WorldDataQuery::GetTopologyKey(const RoadGraph& roadGraph, RoadGraphVertex start) const
+{
+    TopologyKey key;
+    std::vector<RoadGraphVertex> openVertices{start};
+    while (!openVertices.empty())
+    {
+        const auto current = openVertices.back();
+        openVertices.pop_back();
+        const auto& routeElement = get(RouteElement(), roadGraph, current);
+        const auto [successorsBegin, successorsEnd] = adjacent_vertices(current, roadGraph);
+        key.emplace_back(current, routeElement.roadId, routeElement.inOdDirection, static_cast<std::size_t>(std::distance(successorsBegin, successorsEnd)));
+        openVertices.insert(openVertices.end(), std::make_reverse_iterator(successorsEnd), std::make_reverse_iterator(successorsBegin));
+    }
+    return key;
 }
 
 RoadMultiStream::Node WorldDataQuery::CreateRoadMultiStreamRecursive(const RoadGraph& roadGraph, const RoadGraphVertex& current, double sOffset) const
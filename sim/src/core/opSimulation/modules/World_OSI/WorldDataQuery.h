@@ -9,6 +9,8 @@
  ********************************************************************************/
 #pragma once
 
+#include <map>
+#include <mutex>
 #include <numeric>
 #include <utility>
 #include <tuple>
@@ -218,6 +220,9 @@ class WorldDataQuery
 public:
     WorldDataQuery(const OWL::Interfaces::WorldData& worldData);
 
+    //! Drops the cached multi streams, must be called whenever the road network of the world data is replaced
+    void ClearMultiStreamCache();
+
     //! Checks if object is of type T and within the specified range when supplied an offset
     //! Returns true if so; false, otherwise
     //!
@@ -427,6 +432,8 @@ public:
     //! \param startLaneId      OpenDrive id of the lane at the root, where the lane stream should start
     //! \param startDistance    s coordinate at the root, where the lane stream should start
     //! \return     LaneMultiStream starting with the specified lane and containing all consecutive lanes that are also contained in the given road graph
+    //!
+    //! The returned stream is shared with all other requests for the same start lane on a road graph with the same topology
     std::shared_ptr<const LaneMultiStream> CreateLaneMultiStream(const RoadGraph& roadGraph, RoadGraphVertex start, OWL::OdId startLaneId, double startDistance) const;
 
     //! \brief Creates a RoadStream from the given route
@@ -442,6 +449,8 @@ public:
     //! \param roadGraph        road graph to convert, must be a tree
     //! \param start            root of the tree
     //! \return     LaneMultiStream starting with the specified road and containing all consecutive roads that are also contained in the given road graph
+    //!
+    //! The returned stream is shared with all other requests on a road graph with the same topology
     std::shared_ptr<const RoadMultiStream> CreateRoadMultiStream(const RoadGraph& roadGraph, RoadGraphVertex start) const;
 
     //! \brief GetDistanceBetweenObjects gets the distance between two ObjectPositions on a RoadStream
@@ -509,8 +518,23 @@ public:
 
     RouteQueryResult<std::optional<double>> GetLaneDirection (const LaneMultiStream& laneStream, double position) const;
 private:
+    //! Maximum number of cached multi streams per kind, the cache is emptied if it grows beyond
+    static constexpr std::size_t MAX_CACHED_MULTI_STREAMS = 4096;
+
+    //! Vertex, road id, direction and number of successors of all vertices reachable from the root of a road graph in preorder.
+    //! Road graphs with the same key yield the same multi streams.
+    using TopologyKey = std::vector<std::tuple<RoadGraphVertex, std::string, bool, std::size_t>>;
+
     const OWL::Interfaces::WorldData& worldData;
 
+    //! The multi streams only depend on the road network, they are valid until the scenery is created again
+    mutable std::map<std::pair<const OWL::Lane*, TopologyKey>, std::shared_ptr<const LaneMultiStream>> laneMultiStreams;
+    mutable std::map<TopologyKey, std::shared_ptr<const RoadMultiStream>> roadMultiStreams;
+    mutable std::mutex multiStreamMutex;
+
+    //! Returns the topology key of the tree below start
+    TopologyKey GetTopologyKey(const RoadGraph& roadGraph, RoadGraphVertex start) const;
+
     //! Returns the most upstream lane on the specified route such that there is a continous stream of lanes regarding successor/predecessor relation
     //! up to the start lane
     OWL::CLane* GetOriginatingRouteLane(std::vector<RouteElement> route, std::string startRoadId, OWL::OdId startLaneId, double startDistance) const;
@@ -47,6 +47,7 @@ void WorldImplementation::RegisterAgent(AgentInterface* agent)
 {
     agentNetwork.AddAgent(agent);
     worldObjects.push_back(agent);
+    ++generation;
 }
 
 AgentInterface *WorldImplementation::GetAgent(int id) const
@@ -115,6 +116,9 @@ void WorldImplementation::ExtractParameter(ParameterInterface* parameters)
     auto zipperMerge = helper::map::query(boolParameter, "ZipperMerge");
     THROWIFFALSE(zipperMerge.has_value(), "Missing traffic rule ZipperMerge")
     worldParameter.trafficRules.zipperMerge = zipperMerge.value();
+
+    auto poseChangeEpsilon = helper::map::query(doubleParameter, "PoseChangeEpsilon");
+    worldParameter.poseChangeEpsilon = poseChangeEpsilon.value_or(0.0);
 }
 
 void WorldImplementation::Reset()
@@ -183,18 +187,21 @@ void WorldImplementation::PublishGlobalData(int timestamp)
 
 void WorldImplementation::SyncGlobalData(int timestamp)
 {
-    auto lanes = worldData.GetLanes();
-    for (auto lane : lanes)
-    {
-        lane.second->ClearMovingObjects();
-    }
     agentNetwork.SyncGlobalData();
     trafficLightNetwork.UpdateStates(timestamp);
+    ++generation;
+}
+
+std::size_t WorldImplementation::GetGeneration() const
+{
+    return generation;
 }
 
 bool WorldImplementation::CreateScenery(SceneryInterface* scenery, const SceneryDynamicsInterface& sceneryDynamics)
 {
     this->scenery = scenery;
+    filteredRoadGraphs.clear();
+    worldDataQuery.ClearMultiStreamCache();
     sceneryConverter = std::make_unique<SceneryConverter>(scenery,
                                                           repository,
                                                           worldData,
@@ -219,7 +226,7 @@ bool WorldImplementation::CreateScenery(SceneryInterface* scenery, const Scenery
 std::unique_ptr<AgentInterface> WorldImplementation::CreateAgentAdapter(openpass::type::FlatParameter parameter)
 {
     const auto id = repository.Register(openpass::entity::EntityType::MovingObject, openpass::utils::GetEntityInfo(parameter));
-    return std::make_unique<AgentAdapter>(id, this, callbacks, &worldData, localizer);
+    return std::make_unique<AgentAdapter>(id, this, callbacks, &worldData, localizer, worldParameter.poseChangeEpsilon);
 }
 
 std::string WorldImplementation::GetTimeOfDay() const
@@ -299,8 +306,23 @@ RoadNetworkElement WorldImplementation::GetRoadPredecessor(std::string roadId) c
 
 std::pair<RoadGraph, RoadGraphVertex> WorldImplementation::GetRoadGraph(const RouteElement& start, int maxDepth) const
 {
+    const auto key = std::make_pair(start, maxDepth);
+    {
+        std::lock_guard<std::mutex> lock(filteredRoadGraphsMutex);
+        if (const auto filteredRoadGraph = filteredRoadGraphs.find(key); filteredRoadGraph != filteredRoadGraphs.end())
+        {
+            return *filteredRoadGraph->second;
+        }
+    }
+
     auto startVertex = worldData.GetRoadGraphVertexMapping().at(start);
-    return RouteCalculation::FilterRoadGraphByStartPosition(worldData.GetRoadGraph(), startVertex, maxDepth);
+    auto filteredRoadGraph = std::make_shared<const std::pair<RoadGraph, RoadGraphVertex>>(
+        RouteCalculation::FilterRoadGraphByStartPosition(worldData.GetRoadGraph(), startVertex, maxDepth));
+    {
+        std::lock_guard<std::mutex> lock(filteredRoadGraphsMutex);
+        filteredRoadGraphs.emplace(key, filteredRoadGraph);
+    }
+    return *filteredRoadGraph;
 }
 
 std::map<RoadGraphEdge, double> WorldImplementation::GetEdgeWeights(const RoadGraph& roadGraph) const
@@ -13,6 +13,8 @@
 #pragma once
 
 #include <algorithm>
+#include <map>
+#include <mutex>
 #include "include/worldInterface.h"
 #include "AgentNetwork.h"
 #include "SceneryConverter.h"
@@ -38,6 +40,7 @@ struct WorldParameterOSI
         visibilityDistance = 0;
         friction = 0.0;
         weather = "";
+        poseChangeEpsilon = 0.0;
     }
 
     std::string timeOfDay {""};
@@ -45,6 +48,7 @@ struct WorldParameterOSI
     double friction {0.0};
     std::string weather {""};
     TrafficRules trafficRules{};
+    double poseChangeEpsilon {0.0};    //!< Maximum movement of a bounding box corner for which an agent is not relocated
 };
 
 #include "osi3/osi_groundtruth.pb.h"
@@ -134,6 +138,7 @@ public:
 
     void PublishGlobalData(int timestamp) override;
     void SyncGlobalData(int timestamp) override;
+    std::size_t GetGeneration() const override;
 
     bool CreateScenery(SceneryInterface* scenery, const SceneryDynamicsInterface& sceneryDynamics) override;
 
@@ -335,4 +340,11 @@ private:
     DataBufferWriteInterface* dataBuffer;
     openpass::entity::Repository repository;
     std::unique_ptr<SceneryConverter> sceneryConverter;
+
+    //! Road graphs filtered by start element and maximum depth, they only depend on the scenery
+    mutable std::map<std::pair<RouteElement, int>, std::shared_ptr<const std::pair<RoadGraph, RoadGraphVertex>>> filteredRoadGraphs;
+    mutable std::mutex filteredRoadGraphsMutex;
+
+    //! Incremented by SyncGlobalData and RegisterAgent, see GetGeneration
+    std::size_t generation{0};
 };
@@ -27,6 +27,12 @@ const polygon_t& WorldObjectAdapter::GetBoundingBox2D() const
     return boundingBox;
 }
 
+void WorldObjectAdapter::UpdateBoundingBox()
+{
+    boundingBox = CalculateBoundingBox();
+    boundingBoxNeedsUpdate = false;
+}
+
 double WorldObjectAdapter::GetDistanceReferencePointToLeadingEdge() const
 {
     return baseTrafficObject.GetDimension().length / 2.0;
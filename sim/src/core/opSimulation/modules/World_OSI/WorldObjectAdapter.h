@@ -39,6 +39,9 @@ protected:
     double s{0.0};
     mutable bool boundingBoxNeedsUpdate{true};
 
+    //! Calculates the bounding box right away, so that (concurrent) calls of GetBoundingBox2D only read it
+    void UpdateBoundingBox();
+
 private:
     const polygon_t CalculateBoundingBox() const;
 
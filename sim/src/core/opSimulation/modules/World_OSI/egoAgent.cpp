@@ -34,6 +34,7 @@ void EgoAgent::SetRoadGraph(const RoadGraph&& roadGraph, RoadGraphVertex current
 
 void EgoAgent::Update()
 {
+    ResetQueryCache();
     UpdatePositionInGraph();
     if (graphValid)
     {
@@ -80,6 +81,37 @@ RoadGraphVertex EgoAgent::GetRootOfWayToTargetGraph() const {
     return rootOfWayToTargetGraph;
 }
 
+void EgoAgent::ResetQueryCache()
+{
+    queryCache = {};
+}
+
+const EgoAgent::QueryCacheStatistics& EgoAgent::GetQueryCacheStatistics() const
+{
+    return queryCacheStatistics;
+}
+
+template <typename Key, typename Result, typename Query>
+const Result& EgoAgent::QueryCached(std::map<Key, Result>& cache, const Key& key, Query query) const
+{
+    // other agents may have moved or were spawned since the results were cached
+    if (const auto generation = world->GetGeneration(); generation != queryCacheGeneration)
+    {
+        queryCache = {};
+        queryCacheGeneration = generation;
+    }
+
+    auto entry = cache.find(key);
+    if (entry != cache.end())
+    {
+        ++queryCacheStatistics.hits;
+        return entry->second;
+    }
+
+    ++queryCacheStatistics.misses;
+    return cache.emplace(key, query()).first->second;
+}
+
 bool EgoAgent::HasValidRoute() const {
     return graphValid;
 }
@@ -137,30 +169,39 @@ double EgoAgent::GetVelocity(VelocityScope velocityScope, const WorldObjectInter
 
 double EgoAgent::GetDistanceToEndOfLane(double range, int relativeLane) const
 {
-    return world->GetDistanceToEndOfLane(wayToTarget,
-                                         rootOfWayToTargetGraph,
-                                         GetLaneIdFromRelative(relativeLane),
-                                         GetMainLocatePosition().roadPosition.s,
-                                         range).at(0);
+    return QueryCached(queryCache.distanceToEndOfLane, std::make_tuple(range, relativeLane), [&]
+    {
+        return world->GetDistanceToEndOfLane(wayToTarget,
+                                             rootOfWayToTargetGraph,
+                                             GetLaneIdFromRelative(relativeLane),
+                                             GetMainLocatePosition().roadPosition.s,
+                                             range).at(0);
+    });
 }
 
 double EgoAgent::GetDistanceToEndOfLane(double range, int relativeLane, const LaneTypes& acceptableLaneTypes) const
 {
-    return world->GetDistanceToEndOfLane(wayToTarget,
-                                         rootOfWayToTargetGraph,
-                                         GetLaneIdFromRelative(relativeLane),
-                                         GetMainLocatePosition().roadPosition.s,
-                                         range, acceptableLaneTypes).at(0);
+    return QueryCached(queryCache.distanceToEndOfLaneOfLaneTypes, std::make_tuple(range, relativeLane, acceptableLaneTypes), [&]
+    {
+        return world->GetDistanceToEndOfLane(wayToTarget,
+                                             rootOfWayToTargetGraph,
+                                             GetLaneIdFromRelative(relativeLane),
+                                             GetMainLocatePosition().roadPosition.s,
+                                             range, acceptableLaneTypes).at(0);
+    });
 }
 
 RelativeWorldView::Lanes EgoAgent::GetRelativeLanes(double range, int relativeLane, bool includeOncoming) const
 {
-    return world->GetRelativeLanes(wayToTarget,
-                                   rootOfWayToTargetGraph,
-                                   GetLaneIdFromRelative(relativeLane),
-                                   GetMainLocatePosition().roadPosition.s,
-                                   range,
-                                   includeOncoming).at(0);
+    return QueryCached(queryCache.relativeLanes, std::make_tuple(range, relativeLane, includeOncoming), [&]
+    {
+        return world->GetRelativeLanes(wayToTarget,
+                                       rootOfWayToTargetGraph,
+                                       GetLaneIdFromRelative(relativeLane),
+                                       GetMainLocatePosition().roadPosition.s,
+                                       range,
+                                       includeOncoming).at(0);
+    });
 }
 
 std::optional<int> EgoAgent::GetRelativeLaneId(const WorldObjectInterface *object, MeasurementPoint mp) const
@@ -187,40 +228,46 @@ std::optional<int> EgoAgent::GetRelativeLaneId(const WorldObjectInterface *objec
 
 std::vector<const WorldObjectInterface*> EgoAgent::GetObjectsInRange(double backwardRange, double forwardRange, int relativeLane) const
 {
-    auto objectsInRange = world->GetObjectsInRange(wayToTarget,
-                                                   rootOfWayToTargetGraph,
-                                                   GetLaneIdFromRelative(relativeLane),
-                                                   GetMainLocatePosition().roadPosition.s,
-                                                   backwardRange,
-                                                   forwardRange).at(0);
+    return QueryCached(queryCache.objectsInRange, std::make_tuple(backwardRange, forwardRange, relativeLane), [&]
+    {
+        auto objectsInRange = world->GetObjectsInRange(wayToTarget,
+                                                       rootOfWayToTargetGraph,
+                                                       GetLaneIdFromRelative(relativeLane),
+                                                       GetMainLocatePosition().roadPosition.s,
+                                                       backwardRange,
+                                                       forwardRange).at(0);
 
-    auto self = std::find(objectsInRange.cbegin(), objectsInRange.cend(), GetAgent());
+        auto self = std::find(objectsInRange.cbegin(), objectsInRange.cend(), GetAgent());
 
-    if (self != objectsInRange.cend())
-    {
-        objectsInRange.erase(self);
-    }
+        if (self != objectsInRange.cend())
+        {
+            objectsInRange.erase(self);
+        }
 
-    return objectsInRange;
+        return objectsInRange;
+    });
 }
 
 AgentInterfaces EgoAgent::GetAgentsInRange(double backwardRange, double forwardRange, int relativeLane) const
 {
-    auto agentsInRange =  world->GetAgentsInRange(wayToTarget,
-                                                  rootOfWayToTargetGraph,
-                                                  GetLaneIdFromRelative(relativeLane),
-                                                  GetMainLocatePosition().roadPosition.s,
-                                                  backwardRange,
-                                                  forwardRange).at(0);
+    return QueryCached(queryCache.agentsInRange, std::make_tuple(backwardRange, forwardRange, relativeLane), [&]
+    {
+        auto agentsInRange =  world->GetAgentsInRange(wayToTarget,
+                                                      rootOfWayToTargetGraph,
+                                                      GetLaneIdFromRelative(relativeLane),
+                                                      GetMainLocatePosition().roadPosition.s,
+                                                      backwardRange,
+                                                      forwardRange).at(0);
 
-    auto self = std::find(agentsInRange.cbegin(), agentsInRange.cend(), GetAgent());
+        auto self = std::find(agentsInRange.cbegin(), agentsInRange.cend(), GetAgent());
 
-    if (self != agentsInRange.cend())
-    {
-        agentsInRange.erase(self);
-    }
+        if (self != agentsInRange.cend())
+        {
+            agentsInRange.erase(self);
+        }
 
-    return agentsInRange;
+        return agentsInRange;
+    });
 }
 
 std::vector<CommonTrafficSign::Entity> EgoAgent::GetTrafficSignsInRange(double range, int relativeLane) const
@@ -493,6 +540,7 @@ Position EgoAgent::GetWorldPosition(double sDistance, double tDistance, double y
 
 void EgoAgent::SetWayToTarget(RoadGraphVertex targetVertex)
 {
+    ResetQueryCache();
     wayToTarget = RoadGraph{};
     RoadGraphVertex wayPoint = targetVertex;
     auto vertex1 = add_vertex(get(RouteElement(), roadGraph, wayPoint), wayToTarget);
@@ -527,35 +575,44 @@ ExecuteReturn<ObjectsInRange> EgoAgentInterface::executeQuery(ObjectsInRangePara
 
 ExecuteReturn<DistanceToEndOfLane> EgoAgent::executeQueryDistanceToEndOfLane(DistanceToEndOfLaneParameter param) const
 {
-    auto queryResult = world->GetDistanceToEndOfLane(wayToTarget,
-                                                     current,
-                                                     GetLaneIdFromRelative(param.relativeLane),
-                                                     GetMainLocatePosition().roadPosition.s,
-                                                     param.range);
-    std::vector<DistanceToEndOfLane> results;
-    std::transform(alternatives.cbegin(), alternatives.cend(), std::back_inserter(results),
-                   [&](const RoadGraphVertex& alternative){return queryResult.at(alternative);});
-    return {results};
+    return QueryCached(queryCache.distanceToEndOfLaneOfAlternatives, std::make_tuple(param.range, param.relativeLane), [&]
+    {
+        auto queryResult = world->GetDistanceToEndOfLane(wayToTarget,
+                                                         current,
+                                                         GetLaneIdFromRelative(param.relativeLane),
+                                                         GetMainLocatePosition().roadPosition.s,
+                                                         param.range);
+        std::vector<DistanceToEndOfLane> results;
+        std::transform(alternatives.cbegin(), alternatives.cend(), std::back_inserter(results),
+                       [&](const RoadGraphVertex& alternative){return queryResult.at(alternative);});
+        return ExecuteReturn<DistanceToEndOfLane>{results};
+    });
 }
 
 ExecuteReturn<ObjectsInRange> EgoAgent::executeQueryObjectsInRange(ObjectsInRangeParameter param) const
 {
-    auto queryResult = world->GetObjectsInRange(wayToTarget,
-                                                current,
-                                                GetLaneIdFromRelative(param.relativeLane),
-                                                GetMainLocatePosition().roadPosition.s,
-                                                param.backwardRange,
-                                                param.forwardRange);
-    std::vector<ObjectsInRange> results;
-    std::transform(alternatives.cbegin(), alternatives.cend(), std::back_inserter(results),
-                   [&](const RoadGraphVertex& alternative){return queryResult.at(alternative);});
-    return {results};
+    return QueryCached(queryCache.objectsInRangeOfAlternatives, std::make_tuple(param.backwardRange, param.forwardRange, param.relativeLane), [&]
+    {
+        auto queryResult = world->GetObjectsInRange(wayToTarget,
+                                                    current,
+                                                    GetLaneIdFromRelative(param.relativeLane),
+                                                    GetMainLocatePosition().roadPosition.s,
+                                                    param.backwardRange,
+                                                    param.forwardRange);
+        std::vector<ObjectsInRange> results;
+        std::transform(alternatives.cbegin(), alternatives.cend(), std::back_inserter(results),
+                       [&](const RoadGraphVertex& alternative){return queryResult.at(alternative);});
+        return ExecuteReturn<ObjectsInRange>{results};
+    });
 }
 
 RelativeWorldView::Junctions EgoAgent::GetRelativeJunctions(double range) const
 {
-    return world->GetRelativeJunctions(wayToTarget,
-                                       rootOfWayToTargetGraph,
-                                       GetMainLocatePosition().roadPosition.s,
-                                       range).at(0);
+    return QueryCached(queryCache.relativeJunctions, range, [&]
+    {
+        return world->GetRelativeJunctions(wayToTarget,
+                                           rootOfWayToTargetGraph,
+                                           GetMainLocatePosition().roadPosition.s,
+                                           range).at(0);
+    });
 }
@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <map>
+#include <tuple>
+
 #include "include/agentInterface.h"
 #include "include/worldInterface.h"
 #include "include/egoAgentInterface.h"
@@ -17,6 +20,13 @@
 class EgoAgent: public EgoAgentInterface
 {
 public:
+    //! Number of queries, that were answered by the query cache (hits) or had to be evaluated by the world (misses)
+    struct QueryCacheStatistics
+    {
+        size_t hits{0};
+        size_t misses{0};
+    };
+
     EgoAgent(const AgentInterface* agent, const WorldInterface* world) :
         agent(agent),
         world(world)
@@ -94,7 +104,31 @@ public:
 
     RoadGraphVertex GetRootOfWayToTargetGraph() const;
 
+    //! Discards all memoized query results. Is called on every Update and when the route changes.
+    //! Changes of the world without an Update of this agent are detected by its generation
+    void ResetQueryCache();
+
+    const QueryCacheStatistics& GetQueryCacheStatistics() const;
+
 private:
+    //! Results of the route queries since the last reset. As long as neither this agent nor the world changes,
+    //! the results only depend on the parameters of the query, which are used as keys
+    struct QueryCache
+    {
+        std::map<std::tuple<double, int>, double> distanceToEndOfLane;
+        std::map<std::tuple<double, int, LaneTypes>, double> distanceToEndOfLaneOfLaneTypes;
+        std::map<std::tuple<double, int, bool>, RelativeWorldView::Lanes> relativeLanes;
+        std::map<double, RelativeWorldView::Junctions> relativeJunctions;
+        std::map<std::tuple<double, double, int>, std::vector<const WorldObjectInterface*>> objectsInRange;
+        std::map<std::tuple<double, double, int>, AgentInterfaces> agentsInRange;
+        std::map<std::tuple<double, int>, ExecuteReturn<DistanceToEndOfLane>> distanceToEndOfLaneOfAlternatives;
+        std::map<std::tuple<double, double, int>, ExecuteReturn<ObjectsInRange>> objectsInRangeOfAlternatives;
+    };
+
+    //! Returns the cached result for the key or evaluates the query and caches its result
+    template <typename Key, typename Result, typename Query>
+    const Result& QueryCached(std::map<Key, Result>& cache, const Key& key, Query query) const;
+
 
     std::optional<RouteElement> GetPreviousRoad(size_t steps = 1) const;
 
@@ -117,4 +151,8 @@ private:
     RoadGraphVertex rootOfWayToTargetGraph{0};
     std::vector<RoadGraphVertex> alternatives{};
     GlobalRoadPosition mainLocatePosition;
+    mutable QueryCache queryCache;
+    //! Generation of the world the results of the query cache belong to
+    mutable std::size_t queryCacheGeneration{0};
+    mutable QueryCacheStatistics queryCacheStatistics;
 };
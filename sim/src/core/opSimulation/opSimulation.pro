@@ -18,6 +18,8 @@
 CONFIG += OPENPASS_EXECUTABLE
 include(../../../global.pri)
 
+QT += concurrent
+
 win32 {
 # -DLOG_TIME_ENABLED: enable logging of time information
 LIBS += -lws2_32
@@ -30,12 +30,11 @@ const LanePoint *Lane::GetFirstPoint() const
     return &lanePointsReference.front();
 }
 
-void Lane::AddReferencePoint(double x, double y, double hdg, double so, bool inDirection)
+void Lane::AddPoint(std::vector<LanePoint> &points, double x, double y, double hdg, double so, bool inDirection)
 {
     if (inDirection)
     {
-        LanePoint newPoint(x, y, hdg, so);
-        lanePointsReference.push_back(newPoint);
+        points.emplace_back(x, y, hdg, so);
     }
     else
     {
@@ -49,56 +48,37 @@ void Lane::AddReferencePoint(double x, double y, double hdg, double so, bool inD
             new_hdg = hdg - M_PI;
         }
 
-        LanePoint newPoint(x, y, new_hdg, this->length - so);
-        lanePointsReference.push_front(newPoint);
+        points.emplace_back(x, y, new_hdg, this->length - so);
+        pointsReversed = true;
     }
 }
-void Lane::AddRightPoint(double x, double y, double hdg, double so, bool inDirection)
+
+void Lane::AddReferencePoint(double x, double y, double hdg, double so, bool inDirection)
 {
-    if (inDirection)
-    {
-        LanePoint newPoint(x, y, hdg, so);
-        lanePointsRightSide.push_back(newPoint);
-    }
-    else
-    {
-        double new_hdg;
-        if (hdg < M_PI)
-        {
-            new_hdg = hdg + M_PI;
-        }
-        else
-        {
-            new_hdg = hdg - M_PI;
-        }
+    AddPoint(lanePointsReference, x, y, hdg, so, inDirection);
+    referenceSOffsets.push_back(lanePointsReference.back().sOffset);
+}
 
-        LanePoint newPoint(x, y, new_hdg, this->length - so);
-        lanePointsRightSide.push_front(newPoint);
-    }
+void Lane::FinishPoints()
+{
+    if (!pointsReversed)
+        return;
+
+    std::reverse(lanePointsReference.begin(), lanePointsReference.end());
+    std::reverse(lanePointsLeftSide.begin(), lanePointsLeftSide.end());
+    std::reverse(lanePointsRightSide.begin(), lanePointsRightSide.end());
+    std::reverse(referenceSOffsets.begin(), referenceSOffsets.end());
+    pointsReversed = false;
 }
 
-void Lane::AddLeftPoint(double x, double y, double hdg, double so, bool inDirection)
+void Lane::AddRightPoint(double x, double y, double hdg, double so, bool inDirection)
 {
-    if (inDirection)
-    {
-        LanePoint newPoint(x, y, hdg, so);
-        lanePointsLeftSide.push_back(newPoint);
-    }
-    else
-    {
-        double new_hdg;
-        if (hdg < M_PI)
-        {
-            new_hdg = hdg + M_PI;
-        }
-        else
-        {
-            new_hdg = hdg - M_PI;
-        }
+    AddPoint(lanePointsRightSide, x, y, hdg, so, inDirection);
+}
 
-        LanePoint newPoint(x, y, new_hdg, this->length - so);
-        lanePointsLeftSide.push_front(newPoint);
-    }
+void Lane::AddLeftPoint(double x, double y, double hdg, double so, bool inDirection)
+{
+    AddPoint(lanePointsLeftSide, x, y, hdg, so, inDirection);
 }
 
 void Lane::AddPredecessor(const Lane *lane)
@@ -129,16 +109,18 @@ LanePoint Lane::InterpolatePoint(double sLaneCoordinate) const
         auto message = __FILE__ " Line: " + std::to_string(__LINE__) + "sLaneCoordniate out of lane --> Can not interpolate point";
         throw std::runtime_error(message);
     }
-    auto upperPointIter = std::upper_bound(lanePointsReference.begin(), lanePointsReference.end(), sLaneCoordinate,
-                                           [](auto sLaneCoordniate, LanePoint point) -> bool { return (sLaneCoordniate < point.sOffset); });
-    if (upperPointIter == lanePointsReference.end())
+    // binary search on the contiguous s-offsets, the points themselves are only read for interpolation
+    const auto upperIndex =
+        std::upper_bound(referenceSOffsets.begin(), referenceSOffsets.end(), sLaneCoordinate) - referenceSOffsets.begin();
+    if (upperIndex == static_cast<std::ptrdiff_t>(lanePointsReference.size()))
     {
         return lanePointsReference.back();
     }
-    if (upperPointIter == lanePointsReference.begin()) {
+    if (upperIndex == 0) {
         return lanePointsReference.front();
     }
 
+    auto upperPointIter = lanePointsReference.begin() + upperIndex;
     auto lowerPointIter = std::prev(upperPointIter, 1);
     double upperDistanceTo_S_Coordinate = (*upperPointIter).sOffset - sLaneCoordinate;
     double lowerDistanceTo_S_Coordinate = sLaneCoordinate - (*lowerPointIter).sOffset;
@@ -10,6 +10,7 @@
 #pragma once
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 #include "Definitions.h"
 #include "Element.h"
@@ -132,23 +133,23 @@ public:
     }
 
     ///
-    /// \brief Returns a list of all lane points making up the Reference lane.
+    /// \brief Returns all lane points making up the Reference lane, ordered by s-offset.
     ///
-    const std::list<LanePoint> &GetLanePoints() const {
+    const std::vector<LanePoint> &GetLanePoints() const {
         return lanePointsReference;
     }
 
     ///
-    /// \brief Returns a list of all lane points making up the left side of this lane.
+    /// \brief Returns all lane points making up the left side of this lane.
     ///
-    const std::list<LanePoint> &GetLeftSidePoints() const {
+    const std::vector<LanePoint> &GetLeftSidePoints() const {
         return lanePointsLeftSide;
     }
 
     ///
-    /// \brief Returns a list of all lane points making up the right side of this lane.
+    /// \brief Returns all lane points making up the right side of this lane.
     ///
-    const std::list<LanePoint> &GetRightSidePoints() const {
+    const std::vector<LanePoint> &GetRightSidePoints() const {
         return lanePointsRightSide;
     }
 
@@ -192,6 +193,11 @@ public:
     ///
     void AddReferencePoint(double x, double y, double hdg, double so, bool inDirection);
 
+    ///
+    /// \brief Orders the points by s-offset of the lane, must be called once after the last point was added.
+    ///
+    void FinishPoints();
+
     ///
     /// \brief Adds a predecessor lane for this lane.
     ///
@@ -302,6 +308,11 @@ public:
     private:
         bool SLaneCoordinateOutOfLane(double sLane_coordniate) const;
 
+        ///
+        /// \brief Appends the point, points against road direction are reversed by FinishPoints.
+        ///
+        void AddPoint(std::vector<LanePoint> &points, double x, double y, double hdg, double so, bool inDirection);
+
         OwlId owlId;
         double length;
         double width = std::numeric_limits<double>::max();
@@ -309,9 +320,13 @@ public:
         bool inRoadDirection;
 
         const Road *road = nullptr;
-        std::list<LanePoint> lanePointsLeftSide;
-        std::list<LanePoint> lanePointsReference;
-        std::list<LanePoint> lanePointsRightSide;
+        std::vector<LanePoint> lanePointsLeftSide;
+        std::vector<LanePoint> lanePointsReference;
+        std::vector<LanePoint> lanePointsRightSide;
+        // s-offsets of lanePointsReference, kept separately so the search of InterpolatePoint only reads these
+        std::vector<double> referenceSOffsets;
+        // points were added against road direction and are still in reverse order
+        bool pointsReversed = false;
 
         std::unordered_map<const Lane *, const ConflictArea> conflictAreas;
 
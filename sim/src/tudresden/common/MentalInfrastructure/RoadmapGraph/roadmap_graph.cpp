@@ -10,6 +10,10 @@
 
 #include "roadmap_graph.h"
 
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
 #include <string>
 
 #include "common/MentalInfrastructure/Lane.h"
@@ -66,6 +70,26 @@ RoadmapGraph::RoadmapGraph(std::vector<std::shared_ptr<const MentalInfrastructur
             OdMapping.insert(std::make_pair(OdRoadId, temp));
         }
     }
+
+    BuildAdjacency();
+}
+
+void RoadmapGraph::BuildAdjacency() {
+    indexedNodes.clear();
+    nodeIndices.clear();
+    for (const auto &[lane, node] : nodes) {
+        nodeIndices.insert({lane, static_cast<unsigned>(indexedNodes.size())});
+        indexedNodes.push_back(node.get());
+    }
+
+    adjacencyBegin.assign(1, 0);
+    adjacency.clear();
+    for (const auto node : indexedNodes) {
+        for (const auto successor : node->GetSuccessorNodes()) {
+            adjacency.push_back(nodeIndices.at(successor->GetNode()));
+        }
+        adjacencyBegin.push_back(static_cast<unsigned>(adjacency.size()));
+    }
 }
 
 const std::list<const RoadmapNode *> RoadmapGraph::FindShortestPath(const MentalInfrastructure::Lane *start,
@@ -74,73 +98,66 @@ const std::list<const RoadmapNode *> RoadmapGraph::FindShortestPath(const Mental
         const std::string msg = "File: " + static_cast<std::string>(__FILE__) + " Line: " + std::to_string(__LINE__) + " error";
         throw std::runtime_error(msg);
     }
-    const auto &startNode = nodes.at(start);
-    const auto endNode = nodes.at(end).get();
+    const auto key = std::make_pair(nodeIndices.at(start), nodeIndices.at(end));
 
     std::list<const RoadmapNode *> path;
-
-    std::unordered_map<const RoadmapNode *, std::pair<double, const RoadmapNode *>> dijkstragraph = InitializeDijkstra(startNode);
-
-    // use a list of nodes since we do not access the Id anymore (previously map)
-    std::list<const RoadmapNode *> uncheckedNodes;
-
-    std::for_each(nodes.begin(), nodes.end(),
-                  [&uncheckedNodes](const std::pair<const MentalInfrastructure::Lane *, std::shared_ptr<RoadmapNode>> &element) {
-                      uncheckedNodes.push_back(element.second.get());
-                  });
-
-    while (!uncheckedNodes.empty()) {
-        // sort the list of unchecked nodes based on the stored distance inside the dijkstragraph
-        uncheckedNodes.sort([&dijkstragraph](const RoadmapNode *&first, const RoadmapNode *&second) {
-            return dijkstragraph.at(first).first > dijkstragraph.at(second).first;
-        });
-
-        const RoadmapNode *shortest = uncheckedNodes.back();
-        uncheckedNodes.pop_back();
-
-        for (const auto &neighbour : shortest->GetSuccessorNodes()) {
-            // check if one node has the same ID as the neighbour
-            auto res = std::any_of(uncheckedNodes.begin(), uncheckedNodes.end(),
-                                   [&neighbour](const RoadmapNode *node) { return node->GetNode() == neighbour->GetNode(); });
-
-            if (res) {
-                auto alt = (dijkstragraph.at(shortest)).first + shortest->GetLength();
-
-                if (dijkstragraph.at(neighbour).first > alt) {
-                    dijkstragraph.at(neighbour) = std::make_pair(alt, shortest);
-                }
-            }
+    {
+        std::lock_guard<std::mutex> lock(shortestPaths->mtx);
+        auto iter = shortestPaths->paths.find(key);
+        if (iter != shortestPaths->paths.end()) {
+            path = iter->second;
+        }
+        else {
+            path = CalculateShortestPath(key.first, key.second);
+            shortestPaths->paths.insert({key, path});
         }
     }
 
-    path.push_back(endNode);
-    while ((dijkstragraph.at(path.front())).second != nullptr) {
-        const RoadmapNode *front = path.front();
-        path.push_front((dijkstragraph.at(front)).second);
-    }
-
-    if (std::none_of(path.begin(), path.end(), [startNode](auto element) { return element == startNode.get(); }) ||
-        std::none_of(path.begin(), path.end(), [endNode](auto element) { return element == endNode; })) {
+    if (path.empty()) {
         auto msg = __FILE__ " | " + std::to_string(__LINE__) + " | There exist no path to chosen TargetLane";
         throw std::runtime_error(msg);
     }
     return path;
 }
 
-std::unordered_map<const RoadmapNode *, std::pair<double, const RoadmapNode *>>
-RoadmapGraph::InitializeDijkstra(const std::shared_ptr<RoadmapNode> &startNode) const {
-    std::unordered_map<const RoadmapNode *, std::pair<double, const RoadmapNode *>> dijkstragraph;
-    for (auto const &[id, node] : nodes) {
-        if (&startNode == &node) {
-            dijkstragraph.insert(
-                std::pair<const RoadmapNode *, std::pair<double, const RoadmapNode *>>(node.get(), std::make_pair(0, nullptr)));
-        }
-        else {
-            dijkstragraph.insert(
-                std::pair<const RoadmapNode *, std::pair<double, const RoadmapNode *>>(node.get(), std::make_pair(INFINITY, nullptr)));
+std::list<const RoadmapNode *> RoadmapGraph::CalculateShortestPath(unsigned startIndex, unsigned endIndex) const {
+    constexpr unsigned NO_PREDECESSOR = std::numeric_limits<unsigned>::max();
+    std::vector<double> distances(indexedNodes.size(), INFINITY);
+    std::vector<unsigned> predecessors(indexedNodes.size(), NO_PREDECESSOR);
+
+    // entries are not updated in the heap, outdated ones are skipped when popped
+    using HeapEntry = std::pair<double, unsigned>;
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+    distances.at(startIndex) = 0;
+    heap.push({0, startIndex});
+
+    while (!heap.empty()) {
+        const auto [distance, index] = heap.top();
+        heap.pop();
+        if (index == endIndex)
+            break;
+        if (distance > distances[index])
+            continue;
+
+        // the length of a lane is the cost to pass it to any successor (or neighbouring lane)
+        const auto alt = distance + indexedNodes[index]->GetLength();
+        for (auto edge = adjacencyBegin[index]; edge < adjacencyBegin[index + 1]; edge++) {
+            const auto neighbour = adjacency[edge];
+            if (alt < distances[neighbour]) {
+                distances[neighbour] = alt;
+                predecessors[neighbour] = index;
+                heap.push({alt, neighbour});
+            }
         }
     }
-    return dijkstragraph;
+
+    std::list<const RoadmapNode *> path;
+    if (distances.at(endIndex) == INFINITY)
+        return path;
+    for (auto index = endIndex; index != NO_PREDECESSOR; index = predecessors[index]) {
+        path.push_front(indexedNodes[index]);
+    }
+    return path;
 }
 
 void RoadmapNode::AddSuccessor(RoadmapNode *node) {
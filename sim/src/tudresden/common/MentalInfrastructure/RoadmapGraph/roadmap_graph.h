@@ -14,7 +14,9 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "common/Definitions.h"
 // namespace OWL {
@@ -87,7 +89,9 @@ public:
     /*!
      * \brief Finds shortest Path between two Lanes
      *
-     * Takes the lengt of lanes to calculate the shortest path between two given lanes in a road network
+     * Takes the lengt of lanes to calculate the shortest path between two given lanes in a road network.
+     * The graph does not change after its construction, so the result of each (start, end) pair is calculated only once.
+     * May be called by several agents in parallel.
      *
      * \param
      * \return shortest path as a list of lane-IDs from start to end
@@ -95,20 +99,36 @@ public:
     const std::list<const RoadmapNode *> FindShortestPath(const MentalInfrastructure::Lane *start,
                                                           const MentalInfrastructure::Lane *end) const;
 
-    /*!
-     * \brief Initialize a map with length and predecessor values for Dijkastra algorithm
-     * \param
-     * \return Map filled with default starting values
-     */
 private:
     void AddNode(std::shared_ptr<RoadmapNode> node) {
         nodes.insert(std::make_pair(node->GetNode(), std::move(node)));
     }
 
-    std::unordered_map<const RoadmapNode *, std::pair<double, const RoadmapNode *>>
-    InitializeDijkstra(const std::shared_ptr<RoadmapNode> &node) const;
+    /*!
+     * \brief Stores the successors of all nodes in compressed sparse row format for the Dijkstra algorithm
+     */
+    void BuildAdjacency();
+
+    /*!
+     * \brief Dijkstra algorithm with a binary heap on the adjacency arrays
+     * \return shortest path or an empty list if the end is not reachable
+     */
+    std::list<const RoadmapNode *> CalculateShortestPath(unsigned startIndex, unsigned endIndex) const;
 
     std::unordered_map<const MentalInfrastructure::Lane *, std::shared_ptr<RoadmapNode>> nodes;
     std::unordered_map<OdId, std::unordered_map<OwlId, const RoadmapNode *>> OdMapping;
+
+    // successors of node i are adjacency[adjacencyBegin[i], adjacencyBegin[i + 1])
+    std::vector<const RoadmapNode *> indexedNodes;
+    std::unordered_map<const MentalInfrastructure::Lane *, unsigned> nodeIndices;
+    std::vector<unsigned> adjacencyBegin;
+    std::vector<unsigned> adjacency;
+
+    struct ShortestPathCache {
+        std::mutex mtx;
+        std::map<std::pair<unsigned, unsigned>, std::list<const RoadmapNode *>> paths;
+    };
+    // shared by copies of the graph, they share the nodes as well
+    std::shared_ptr<ShortestPathCache> shortestPaths = std::make_shared<ShortestPathCache>();
 };
 } // namespace RoadmapGraph
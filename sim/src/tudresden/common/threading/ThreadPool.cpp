@@ -0,0 +1,104 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+ThreadPool &ThreadPool::GetInstance() {
+    static ThreadPool instance(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return instance;
+}
+
+ThreadPool::ThreadPool(unsigned numberOfWorkers) {
+    workers.reserve(numberOfWorkers);
+    for (unsigned i = 0; i < numberOfWorkers; ++i) {
+        workers.emplace_back([this] { WorkerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> l(mtx);
+        stop = true;
+    }
+    jobAvailable.notify_all();
+    std::for_each(workers.begin(), workers.end(), std::mem_fn(&std::thread::join));
+}
+
+void ThreadPool::ParallelFor(std::size_t count, const Body &body) {
+    if (count == 0) {
+        return;
+    }
+
+    if (workers.empty() || count == 1) {
+        body(0, 0, count);
+        return;
+    }
+
+    // several chunks per thread, so threads finishing early can help the others
+    Job job;
+    job.body = &body;
+    job.count = count;
+    job.chunkSize = std::max<std::size_t>(1, count / (4 * GetNumberOfSlots()));
+
+    {
+        std::lock_guard<std::mutex> l(mtx);
+        jobs.push_back(&job);
+    }
+    jobAvailable.notify_all();
+
+    Execute(job);
+
+    {
+        std::unique_lock<std::mutex> l(mtx);
+        auto it = std::find(jobs.begin(), jobs.end(), &job);
+        if (it != jobs.end()) {
+            jobs.erase(it);
+        }
+        workerFinished.wait(l, [&job] { return job.activeWorkers == 0; });
+    }
+
+    if (job.exception) {
+        std::rethrow_exception(job.exception);
+    }
+}
+
+void ThreadPool::WorkerLoop() {
+    std::unique_lock<std::mutex> l(mtx);
+    while (true) {
+        jobAvailable.wait(l, [this] { return stop || !jobs.empty(); });
+        if (stop) {
+            return;
+        }
+
+        Job *job = jobs.front();
+        // all chunks are taken, no need for further workers
+        if (job->nextIndex >= job->count) {
+            jobs.pop_front();
+            continue;
+        }
+
+        ++job->activeWorkers;
+        l.unlock();
+        Execute(*job);
+        l.lock();
+        --job->activeWorkers;
+        workerFinished.notify_all();
+    }
+}
+
+void ThreadPool::Execute(Job &job) {
+    const unsigned slot = job.nextSlot++;
+
+    for (auto begin = job.nextIndex.fetch_add(job.chunkSize); begin < job.count; begin = job.nextIndex.fetch_add(job.chunkSize)) {
+        try {
+            (*job.body)(slot, begin, std::min(begin + job.chunkSize, job.count));
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> l(job.exceptionMtx);
+            if (!job.exception) {
+                job.exception = std::current_exception();
+            }
+            // skip the remaining chunks
+            job.nextIndex = job.count;
+        }
+    }
+}
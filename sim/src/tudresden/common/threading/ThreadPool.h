@@ -0,0 +1,81 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///
+/// Process-wide pool of worker threads for data parallel loops.
+///
+/// The workers are created once and wait for jobs, so a parallel loop does not pay for thread creation.
+/// The thread calling ParallelFor takes part in the execution, so ParallelFor may be called from several
+/// threads at the same time (e.g. by agents executed in parallel) and even from a worker of the pool.
+///
+class ThreadPool {
+  public:
+    ///
+    /// \brief Loop body, called with the slot of the executing thread and the index range [begin, end) to process.
+    ///
+    /// The slot is unique within one ParallelFor call and smaller than GetNumberOfSlots(), so it can be used
+    /// to select a per thread result buffer without synchronisation.
+    ///
+    using Body = std::function<void(unsigned slot, std::size_t begin, std::size_t end)>;
+
+    ///
+    /// \brief Returns the pool shared by the whole process.
+    ///
+    static ThreadPool &GetInstance();
+
+    ///
+    /// \param numberOfWorkers  threads created in addition to the calling threads
+    ///
+    explicit ThreadPool(unsigned numberOfWorkers);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ///
+    /// \brief Maximum number of threads executing one ParallelFor call (workers and calling thread).
+    ///
+    unsigned GetNumberOfSlots() const {
+        return static_cast<unsigned>(workers.size()) + 1;
+    }
+
+    ///
+    /// \brief Splits [0, count) into chunks and executes them on the pool. Returns after all chunks have been
+    /// processed. The first exception thrown by the body is rethrown on the calling thread.
+    ///
+    void ParallelFor(std::size_t count, const Body &body);
+
+  private:
+    struct Job {
+        const Body *body;
+        std::size_t count;
+        std::size_t chunkSize;
+        std::atomic<std::size_t> nextIndex{0};
+        std::atomic<unsigned> nextSlot{0};
+        unsigned activeWorkers{0}; // guarded by ThreadPool::mtx
+        std::exception_ptr exception;
+        std::mutex exceptionMtx;
+    };
+
+    void WorkerLoop();
+    static void Execute(Job &job);
+
+    std::vector<std::thread> workers;
+    std::deque<Job *> jobs;
+    bool stop{false};
+    std::mutex mtx;
+    std::condition_variable jobAvailable;
+    std::condition_variable workerFinished;
+};
+
+#endif // THREADPOOL_H
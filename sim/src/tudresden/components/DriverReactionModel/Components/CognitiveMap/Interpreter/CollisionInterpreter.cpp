@@ -10,14 +10,14 @@
 
 #include "CollisionInterpreter.h"
 
-#include <future>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <iostream>
 
 #include "common/Helper.h"
 
 namespace Interpreter {
-bool use_Threads = false;
-
 // time step size for collision detection (s)
 const double TIME_STEP = 0.3;
 // max extrapolation time (s)
@@ -28,6 +28,21 @@ const int MAX_LANES_AHEAD = 2;
 // amount of vertices for generating a polygon based on an circle (for
 // pedestrians) e.g. 4 vertices will result in a rectangle
 const int CIRCLE_POLYGON_PRECISION = 8;
+// margin added to length and width of the agents (m)
+const double SAFETY_MARGIN = 0.05;
+
+namespace {
+const std::vector<double> &GetSampleTimes() {
+    static const std::vector<double> sampleTimes = [] {
+        std::vector<double> times;
+        for (auto time = 0.0; time <= MAX_TIME; time += TIME_STEP) {
+            times.push_back(time);
+        }
+        return times;
+    }();
+    return sampleTimes;
+}
+} // namespace
 
 void CollisionInterpreter::Update(WorldInterpretation *interpretation, const WorldRepresentation &representation) {
     try {
@@ -50,6 +65,9 @@ void CollisionInterpreter::DetermineCollisionPoints(WorldInterpretation *interpr
     if (representation.agentMemory->empty()) {
         return;
     }
+    // the ego trajectory is calculated on demand, the first observed agent passing the early outs needs it
+    egoTrajectoryValid = false;
+
     for (const auto &agent : *representation.agentMemory) {
         auto &agentInterpretation = interpretation->interpretedAgents.at(agent->GetID());
         agentInterpretation->collisionPoint = CalculationCollisionPoint(representation, *agent);
@@ -57,10 +75,7 @@ void CollisionInterpreter::DetermineCollisionPoints(WorldInterpretation *interpr
 }
 
 std::optional<CollisionPoint> CollisionInterpreter::CalculationCollisionPoint(const WorldRepresentation &representation,
-                                                                              const AgentRepresentation &observedAgent) const {
-    std::vector<std::future<std::optional<CollisionPoint>>> futures;
-    std::vector<CollisionPoint> resultCP;
-
+                                                                              const AgentRepresentation &observedAgent) {
     if (representation.egoAgent->GetMainLocatorLane() == representation.egoAgent->GetLanePosition().lane->GetLeftLane() ||
         representation.egoAgent->GetMainLocatorLane() == representation.egoAgent->GetLanePosition().lane->GetRightLane()) {
         // lane change
@@ -73,66 +88,37 @@ std::optional<CollisionPoint> CollisionInterpreter::CalculationCollisionPoint(co
         return std::nullopt;
     }
 
-    if (use_Threads) {
-        unsigned nb_threads_hint = std::thread::hardware_concurrency();
-        unsigned nb_threads = nb_threads_hint == 0 ? 8 : (nb_threads_hint);
-        for (double startTime = 0; startTime < MAX_TIME; startTime += MAX_TIME / nb_threads) {
-            double endTime = startTime + MAX_TIME / nb_threads;
-            futures.push_back(std::async(std::launch::async, &CollisionInterpreter::PerformCollisionPointCalculation, this, startTime,
-                                         endTime, representation, observedAgent));
-        }
-
-        for (auto &f : futures) {
-            auto cp = f.get();
-            if (cp) {
-                resultCP.push_back(*cp);
-            }
-        }
-        if (resultCP.empty()) {
-            return std::nullopt;
-        }
-        CollisionPoint crashPoint =
-            *std::min_element(resultCP.begin(), resultCP.end(), [](auto a, auto b) { return a.timeToCollision < b.timeToCollision; });
-        return crashPoint;
-    }
-    else {
-        auto result = PerformCollisionPointCalculation(0, MAX_TIME, representation, observedAgent);
-        if (!result) {
-            return std::nullopt;
-        }
-        return *result;
+    if (!egoTrajectoryValid) {
+        CalculateTrajectory(*representation.egoAgent, egoTrajectory);
+        egoTrajectoryValid = true;
     }
+    CalculateTrajectory(observedAgent, observedTrajectory);
+    return PerformCollisionPointCalculation(observedAgent);
 }
 
-std::optional<CollisionPoint> CollisionInterpreter::PerformCollisionPointCalculation(double timeStart, double timeEnd,
-                                                                                     const WorldRepresentation &representation,
-                                                                                     const AgentRepresentation &observedAgent) const {
-    for (auto time = timeStart; time <= timeEnd; time += TIME_STEP) {
-        double egoDistance = representation.egoAgent->ExtrapolateDistanceAlongLane(time);
-        double observedDistance = observedAgent.ExtrapolateDistanceAlongLane(time);
-        auto positionEgoAgent = representation.egoAgent->FindNewPositionInDistance(egoDistance);
-        auto positionObservedAgent = observedAgent.FindNewPositionInDistance(observedDistance);
-
-        if (!positionEgoAgent || !positionObservedAgent) {
-            // agent out of road map
-            return std::nullopt;
-        }
-
-        auto ego = positionEgoAgent->lane->InterpolatePoint(positionEgoAgent->sCoordinate);
-        auto observed = positionObservedAgent->lane->InterpolatePoint(positionObservedAgent->sCoordinate);
+std::optional<CollisionPoint> CollisionInterpreter::PerformCollisionPointCalculation(const AgentRepresentation &observedAgent) const {
+    // the agents can only meet where the areas swept by their boxes overlap
+    if (egoTrajectory.maxX < observedTrajectory.minX || observedTrajectory.maxX < egoTrajectory.minX ||
+        egoTrajectory.maxY < observedTrajectory.minY || observedTrajectory.maxY < egoTrajectory.minY) {
+        return std::nullopt;
+    }
 
-        double hdgEgo = representation.egoAgent->IsMovingInLaneDirection() ? ego.hdg : ego.hdg + M_PI;
-        double hdgObserved = observedAgent.IsMovingInLaneDirection() ? observed.hdg : observed.hdg + M_PI;
-        // Take the actual position and yaw angle for small distances
-        hdgEgo = egoDistance < 0.3 ? representation.egoAgent->GetYawAngle() : hdgEgo;
-        hdgObserved = observedDistance < 0.3 ? observedAgent.GetYawAngle() : hdgObserved;
+    const auto maxCenterDistance = egoTrajectory.radius + observedTrajectory.radius;
+    const auto &sampleTimes = GetSampleTimes();
+    // the check ends with the first sample of an agent out of road map
+    const auto numberOfSamples = std::min(egoTrajectory.Size(), observedTrajectory.Size());
 
-        auto shapeEgo = ConstructAgentPolygonRepresentation(*representation.egoAgent, {ego.x, ego.y}, hdgEgo);
-        auto shapeObserved = ConstructAgentPolygonRepresentation(observedAgent, {observed.x, observed.y}, hdgObserved);
+    for (std::size_t sample = 0; sample < numberOfSamples; ++sample) {
+        const auto dx = observedTrajectory.centerX[sample] - egoTrajectory.centerX[sample];
+        const auto dy = observedTrajectory.centerY[sample] - egoTrajectory.centerY[sample];
+        if (dx * dx + dy * dy > maxCenterDistance * maxCenterDistance) {
+            continue;
+        }
 
-        if (boost::geometry::intersects(shapeEgo, shapeObserved)) {
+        if (BoxesIntersect(egoTrajectory, observedTrajectory, sample)) {
+            const auto time = sampleTimes[sample];
             CollisionPoint possibleCollisionPoint;
-            possibleCollisionPoint.distanceCP = egoDistance;
+            possibleCollisionPoint.distanceCP = egoTrajectory.distance[sample];
             possibleCollisionPoint.oAgentID = observedAgent.GetID();
             possibleCollisionPoint.timeToCollision = time;
             possibleCollisionPoint.collisionImminent = time <= GetBehaviourData().adBehaviour.collisionImminentMargin;
@@ -142,53 +128,88 @@ std::optional<CollisionPoint> CollisionInterpreter::PerformCollisionPointCalcula
     return std::nullopt;
 }
 
-polygon_t CollisionInterpreter::ConstructAgentPolygonRepresentation(const AgentRepresentation &data, const Common::Vector2d pos,
-                                                                    const double hdg) const {
-    switch (data.GetVehicleType()) { // TODO it just constructs a polygon, why the switch?
+void CollisionInterpreter::CalculateTrajectory(const AgentRepresentation &agent, Trajectory &trajectory) const {
+    switch (agent.GetVehicleType()) {
     case DReaMDefinitions::AgentVehicleType::Car:
-        return ConstructPolygonRepresentation(data, pos, hdg);
     case DReaMDefinitions::AgentVehicleType::Truck:
-        return ConstructPolygonRepresentation(data, pos, hdg);
     case DReaMDefinitions::AgentVehicleType::Pedestrian:
-        return ConstructPolygonRepresentation(data, pos, hdg);
     case DReaMDefinitions::AgentVehicleType::Bicycle:
-        return ConstructPolygonRepresentation(data, pos, hdg);
+        break;
     default:
         std::string message = __FILE__ " Line: " + std::to_string(__LINE__) + "AgentType does not exist";
         Log(message, DReaMLogLevel::error);
         throw std::runtime_error(message);
     }
+
+    trajectory.distance.clear();
+    trajectory.centerX.clear();
+    trajectory.centerY.clear();
+    trajectory.cosHdg.clear();
+    trajectory.sinHdg.clear();
+
+    trajectory.halfLength = (agent.GetLength() / 2.0) + SAFETY_MARGIN;
+    trajectory.halfWidth = (agent.GetWidth() / 2.0) + SAFETY_MARGIN;
+    trajectory.radius = std::hypot(trajectory.halfLength, trajectory.halfWidth);
+    trajectory.minX = std::numeric_limits<double>::max();
+    trajectory.minY = std::numeric_limits<double>::max();
+    trajectory.maxX = std::numeric_limits<double>::lowest();
+    trajectory.maxY = std::numeric_limits<double>::lowest();
+
+    // the box is centered on the vehicle, the lane point is its reference point
+    const double offsetReferencePoint = agent.GetDistanceReferencePointToLeadingEdge() - agent.GetLength() / 2;
+
+    for (const auto time : GetSampleTimes()) {
+        const double distance = agent.ExtrapolateDistanceAlongLane(time);
+        const auto position = agent.FindNewPositionInDistance(distance);
+        if (!position) {
+            // agent out of road map
+            break;
+        }
+
+        const auto point = position->lane->InterpolatePoint(position->sCoordinate);
+        double hdg = agent.IsMovingInLaneDirection() ? point.hdg : point.hdg + M_PI;
+        // Take the actual yaw angle for small distances
+        hdg = distance < 0.3 ? agent.GetYawAngle() : hdg;
+
+        const double cosHdg = std::cos(hdg);
+        const double sinHdg = std::sin(hdg);
+        const double centerX = point.x + cosHdg * offsetReferencePoint;
+        const double centerY = point.y + sinHdg * offsetReferencePoint;
+
+        trajectory.distance.push_back(distance);
+        trajectory.centerX.push_back(centerX);
+        trajectory.centerY.push_back(centerY);
+        trajectory.cosHdg.push_back(cosHdg);
+        trajectory.sinHdg.push_back(sinHdg);
+
+        trajectory.minX = std::min(trajectory.minX, centerX - trajectory.radius);
+        trajectory.minY = std::min(trajectory.minY, centerY - trajectory.radius);
+        trajectory.maxX = std::max(trajectory.maxX, centerX + trajectory.radius);
+        trajectory.maxY = std::max(trajectory.maxY, centerY + trajectory.radius);
+    }
 }
 
-polygon_t CollisionInterpreter::ConstructPolygonRepresentation(const AgentRepresentation &agent, const Common::Vector2d pos,
-                                                               const double hdg) const {
-    // Initial bounding box in local coordinate system
-    double safetyMargin = 0.05;
-    double lengthHalf = (agent.GetLength() / 2.0) + safetyMargin;
-    double widthHalf = (agent.GetWidth() / 2.0) + safetyMargin;
-
-    double boxPoints[][2]{
-        {-lengthHalf, -widthHalf}, {lengthHalf, -widthHalf}, {lengthHalf, widthHalf}, {-lengthHalf, widthHalf}, {-lengthHalf, -widthHalf}};
-    polygon_t box;
-    bg::append(box, boxPoints);
-
-    //// translate offset of reference point
-    polygon_t referencePointBox;
-    double offsetReferencePoint = agent.GetDistanceReferencePointToLeadingEdge() - agent.GetLength() / 2;
-    bt::translate_transformer<double, 2, 2> translateOffset(offsetReferencePoint, 0);
-    bg::transform(box, referencePointBox, translateOffset);
-
-    // rotation in mathematical negative orientation (boost) -> inverte to match
-    polygon_t agentBoxRot;
-    bt::rotate_transformer<bg::radian, double, 2, 2> rotate(-hdg);
-    bg::transform(referencePointBox, agentBoxRot, rotate);
-
-    // translate by locatedPoint
-    polygon_t agentBox;
-    bt::translate_transformer<double, 2, 2> translate(pos.x, pos.y);
-    bg::transform(agentBoxRot, agentBox, translate);
-
-    return agentBox;
+bool CollisionInterpreter::BoxesIntersect(const Trajectory &first, const Trajectory &second, std::size_t sample) {
+    const double dx = second.centerX[sample] - first.centerX[sample];
+    const double dy = second.centerY[sample] - first.centerY[sample];
+
+    // axes of both boxes: the heading and its normal
+    const double axes[4][2] = {{first.cosHdg[sample], first.sinHdg[sample]},
+                               {-first.sinHdg[sample], first.cosHdg[sample]},
+                               {second.cosHdg[sample], second.sinHdg[sample]},
+                               {-second.sinHdg[sample], second.cosHdg[sample]}};
+
+    for (const auto &axis : axes) {
+        const double firstExtent = first.halfLength * std::abs(axes[0][0] * axis[0] + axes[0][1] * axis[1]) +
+                                   first.halfWidth * std::abs(axes[1][0] * axis[0] + axes[1][1] * axis[1]);
+        const double secondExtent = second.halfLength * std::abs(axes[2][0] * axis[0] + axes[2][1] * axis[1]) +
+                                    second.halfWidth * std::abs(axes[3][0] * axis[0] + axes[3][1] * axis[1]);
+        // touching boxes intersect
+        if (std::abs(dx * axis[0] + dy * axis[1]) > firstExtent + secondExtent) {
+            return false;
+        }
+    }
+    return true;
 }
 
 } // namespace Interpreter
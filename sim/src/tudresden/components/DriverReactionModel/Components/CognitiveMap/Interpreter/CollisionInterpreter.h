@@ -12,21 +12,8 @@
 #include "InterpreterInterface.h"
 #include "Common/WorldRepresentation.h"
 #include "qglobal.h"
-#include <boost/geometry.hpp>
-#include <boost/geometry/geometries/adapted/c_array.hpp>
-#include <boost/geometry/geometries/point_xy.hpp>
-#include <boost/geometry/geometries/polygon.hpp>
-#include <boost/geometry/geometry.hpp>
 
-typedef boost::geometry::model::d2::point_xy<double> point_t;
-typedef boost::geometry::model::polygon<point_t> polygon_t;
-typedef boost::geometry::model::box<point_t> box_t;
-
-namespace bg = boost::geometry;
-namespace bt = boost::geometry::strategy::transform;
-
-typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
-namespace trans = boost::geometry::strategy::transform;
+#include <vector>
 
 namespace Interpreter {
 class CollisionInterpreter : public InterpreterInterface {
@@ -41,16 +28,49 @@ class CollisionInterpreter : public InterpreterInterface {
     virtual void Update(WorldInterpretation* interpretation, const WorldRepresentation& representation) override;
 
   private:
+    ///
+    /// \brief Oriented boxes of an agent at the time samples of the collision check, stored as plain arrays
+    ///
+    struct Trajectory {
+        std::vector<double> distance;
+        std::vector<double> centerX;
+        std::vector<double> centerY;
+        std::vector<double> cosHdg;
+        std::vector<double> sinHdg;
+
+        double halfLength{0};
+        double halfWidth{0};
+        // radius of the circle around a box
+        double radius{0};
+        // bounds of all boxes of the trajectory
+        double minX{0};
+        double minY{0};
+        double maxX{0};
+        double maxY{0};
+
+        // number of samples before the agent leaves the road network
+        std::size_t Size() const { return distance.size(); }
+    };
+
     void DetermineCollisionPoints(WorldInterpretation* interpretation, const WorldRepresentation& representation);
 
     std::optional<CollisionPoint> CalculationCollisionPoint(const WorldRepresentation& representation,
-                                                            const AgentRepresentation& observedAgent) const;
-    std::optional<CollisionPoint> PerformCollisionPointCalculation(double timeStart, double timeEnd,
-                                                                   const WorldRepresentation& representation,
-                                                                   const AgentRepresentation& observedAgent) const;
+                                                            const AgentRepresentation& observedAgent);
+    std::optional<CollisionPoint> PerformCollisionPointCalculation(const AgentRepresentation& observedAgent) const;
+
+    ///
+    /// \brief Extrapolates the agent along its lanes for all time samples
+    ///
+    void CalculateTrajectory(const AgentRepresentation& agent, Trajectory& trajectory) const;
 
-    polygon_t ConstructAgentPolygonRepresentation(const AgentRepresentation& data, const Common::Vector2d pos, const double hdg) const;
+    ///
+    /// \brief Separating axis test of the boxes of both trajectories at the sample
+    ///
+    static bool BoxesIntersect(const Trajectory& first, const Trajectory& second, std::size_t sample);
 
-    polygon_t ConstructPolygonRepresentation(const AgentRepresentation &data, const Common::Vector2d pos, const double hdg) const;
+    // trajectory of the ego agent, shared by all observed agents of one update
+    Trajectory egoTrajectory;
+    bool egoTrajectoryValid{false};
+    Trajectory observedTrajectory;
 };
 } // namespace Interpreter
@@ -1,34 +1,128 @@
 #include "ConflictAreaCalculator.h"
 
+#include <algorithm>
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <iterator>
+#include <tuple>
+
+#include "Common/Threading/ThreadPool.h"
+
 namespace GlobalObserver::Calculators {
+namespace {
+using BoundsPoint = boost::geometry::model::d2::point_xy<double>;
+using Bounds = boost::geometry::model::box<BoundsPoint>;
+using IndexedBounds = std::pair<Bounds, std::size_t>;
+
+// intersection points may lie up to this distance outside of the intersected segments
+const double INTERSECTION_THRESHOLD = 0.3;
+
+///
+/// \brief Bounds of the left and right side points of the lane, enlarged by the intersection threshold.
+/// \return nullopt if a side has less than two points, such a lane can not have a conflict area
+///
+std::optional<Bounds> SideBounds(const MentalInfrastructure::Lane &lane) {
+    const auto &leftPoints = lane.GetLeftSidePoints();
+    const auto &rightPoints = lane.GetRightSidePoints();
+    if (leftPoints.size() < 2 || rightPoints.size() < 2)
+        return std::nullopt;
+
+    double minX = std::numeric_limits<double>::max();
+    double minY = std::numeric_limits<double>::max();
+    double maxX = std::numeric_limits<double>::lowest();
+    double maxY = std::numeric_limits<double>::lowest();
+    for (const auto *points : {&leftPoints, &rightPoints}) {
+        for (const auto &point : *points) {
+            minX = std::min(minX, point.x);
+            minY = std::min(minY, point.y);
+            maxX = std::max(maxX, point.x);
+            maxY = std::max(maxY, point.y);
+        }
+    }
+    return Bounds{{minX - INTERSECTION_THRESHOLD, minY - INTERSECTION_THRESHOLD},
+                  {maxX + INTERSECTION_THRESHOLD, maxY + INTERSECTION_THRESHOLD}};
+}
+} // namespace
+
 void ConflictAreaCalculator::Populate() {
     if (conflictAreasCreated)
         return;
 
-    for (const auto &currentLane : infrastructurePerception->lanes) {
-        for (const auto &intersectionLane : infrastructurePerception->lanes) {
-            if (PotentialConflictAreaExist(currentLane, intersectionLane)) {
-                if (auto conflictAreas = CalculateConflictAreas(currentLane.get(), intersectionLane.get())) {
-                    const_cast<MentalInfrastructure::Lane *>(currentLane.get())
-                        ->AddConflictArea({intersectionLane.get(), conflictAreas->first});
-                    const_cast<MentalInfrastructure::Lane *>(intersectionLane.get())
-                        ->AddConflictArea({currentLane.get(), conflictAreas->second});
+    const auto &lanes = infrastructurePerception->lanes;
+
+    // a conflict area needs intersecting side lines, so only lanes with overlapping bounds can have one
+    std::vector<IndexedBounds> laneBounds;
+    for (std::size_t index = 0; index < lanes.size(); ++index) {
+        if (auto bounds = SideBounds(*lanes.at(index))) {
+            laneBounds.emplace_back(*bounds, index);
+        }
+    }
+    const boost::geometry::index::rtree<IndexedBounds, boost::geometry::index::quadratic<16>> laneIndex(laneBounds.begin(),
+                                                                                                       laneBounds.end());
 
-                    std::string junctionInvalid = "not on Junction";
-                    std::string junctionIdFirst = conflictAreas->first.road->IsOnJunction()
-                                                      ? conflictAreas->first.road->GetJunction()->GetOpenDriveId()
-                                                      : junctionInvalid;
-                    std::string junctionIdSecond = conflictAreas->second.road->IsOnJunction()
-                                                       ? conflictAreas->second.road->GetJunction()->GetOpenDriveId()
-                                                       : junctionInvalid;
-                    std::string junctionId = junctionIdFirst != junctionInvalid ? junctionIdFirst : junctionIdSecond;
-                    std::vector<std::pair<MentalInfrastructure::ConflictArea, MentalInfrastructure::ConflictArea>> vec;
+    std::vector<std::vector<std::size_t>> candidates(lanes.size());
+    std::vector<IndexedBounds> overlaps;
+    for (const auto &[bounds, index] : laneBounds) {
+        overlaps.clear();
+        laneIndex.query(boost::geometry::index::intersects(bounds), std::back_inserter(overlaps));
+        for (const auto &overlap : overlaps) {
+            candidates.at(index).push_back(overlap.second);
+        }
+        std::sort(candidates.at(index).begin(), candidates.at(index).end());
+    }
 
-                    infrastructurePerception->conflictAreas.insert({junctionId, vec});
-                    infrastructurePerception->conflictAreas.at(junctionId).push_back(std::move(*conflictAreas));
+    // the pair tests only read the lanes, the conflict areas are added afterwards
+    struct PairResult {
+        std::size_t currentIndex;
+        std::size_t intersectionIndex;
+        std::pair<MentalInfrastructure::ConflictArea, MentalInfrastructure::ConflictArea> conflictAreas;
+    };
+    auto &threadPool = ThreadPool::GetInstance();
+    std::vector<std::vector<PairResult>> slotResults(threadPool.GetNumberOfSlots());
+    threadPool.ParallelFor(lanes.size(), [&](unsigned slot, std::size_t begin, std::size_t end) {
+        for (auto currentIndex = begin; currentIndex < end; ++currentIndex) {
+            const auto &currentLane = lanes.at(currentIndex);
+            for (auto intersectionIndex : candidates.at(currentIndex)) {
+                const auto &intersectionLane = lanes.at(intersectionIndex);
+                if (PotentialConflictAreaExist(currentLane, intersectionLane)) {
+                    if (auto conflictAreas = CalculateConflictAreas(currentLane.get(), intersectionLane.get())) {
+                        slotResults.at(slot).push_back({currentIndex, intersectionIndex, std::move(*conflictAreas)});
+                    }
                 }
             }
         }
+    });
+
+    std::vector<PairResult> results;
+    for (auto &slotResult : slotResults) {
+        std::move(slotResult.begin(), slotResult.end(), std::back_inserter(results));
+    }
+    // add in the order of the sequential pair loop, so the output does not depend on the thread scheduling
+    std::sort(results.begin(), results.end(), [](const PairResult &a, const PairResult &b) {
+        return std::tie(a.currentIndex, a.intersectionIndex) < std::tie(b.currentIndex, b.intersectionIndex);
+    });
+
+    for (auto &result : results) {
+        const auto &currentLane = lanes.at(result.currentIndex);
+        const auto &intersectionLane = lanes.at(result.intersectionIndex);
+        // the reverse pair was added before
+        if (currentLane->GetConflictAreaWithLane(intersectionLane.get()))
+            continue;
+
+        auto &conflictAreas = result.conflictAreas;
+        const_cast<MentalInfrastructure::Lane *>(currentLane.get())->AddConflictArea({intersectionLane.get(), conflictAreas.first});
+        const_cast<MentalInfrastructure::Lane *>(intersectionLane.get())->AddConflictArea({currentLane.get(), conflictAreas.second});
+
+        std::string junctionInvalid = "not on Junction";
+        std::string junctionIdFirst =
+            conflictAreas.first.road->IsOnJunction() ? conflictAreas.first.road->GetJunction()->GetOpenDriveId() : junctionInvalid;
+        std::string junctionIdSecond =
+            conflictAreas.second.road->IsOnJunction() ? conflictAreas.second.road->GetJunction()->GetOpenDriveId() : junctionInvalid;
+        std::string junctionId = junctionIdFirst != junctionInvalid ? junctionIdFirst : junctionIdSecond;
+        std::vector<std::pair<MentalInfrastructure::ConflictArea, MentalInfrastructure::ConflictArea>> vec;
+
+        infrastructurePerception->conflictAreas.insert({junctionId, vec});
+        infrastructurePerception->conflictAreas.at(junctionId).push_back(std::move(conflictAreas));
     }
 
     conflictAreasCreated = true;
@@ -101,7 +195,7 @@ ConflictAreaCalculator::IntersectionPoints(const MentalInfrastructure::LanePoint
     if (!point) {
         return std::nullopt;
     }
-    double threshold = 0.3;
+    const double threshold = INTERSECTION_THRESHOLD;
     if (((std::min(p1->x, p2->x) <= point->x + threshold && std::max(p1->x, p2->x) >= point->x - threshold) &&
          ((std::min(p1->y, p2->y) <= point->y + threshold && std::max(p1->y, p2->y) >= point->y - threshold))) &&
         ((std::min(q1->x, q2->x) <= point->x + threshold && std::max(q1->x, q2->x) >= point->x - threshold) &&
@@ -245,10 +339,13 @@ ConflictAreaCalculator::CalculateConflictAreas(const MentalInfrastructure::Lane
 }
 
 std::pair<std::vector<MentalInfrastructure::LanePoint>, std::vector<MentalInfrastructure::LanePoint>>
-ConflictAreaCalculator::CalculateLaneIntersectionPoints(const std::list<MentalInfrastructure::LanePoint> &lanePointsA,
-                                                        const std::list<MentalInfrastructure::LanePoint> &lanePointsB) const {
+ConflictAreaCalculator::CalculateLaneIntersectionPoints(const std::vector<MentalInfrastructure::LanePoint> &lanePointsA,
+                                                        const std::vector<MentalInfrastructure::LanePoint> &lanePointsB) const {
     std::vector<MentalInfrastructure::LanePoint> intersectionPointA;
     std::vector<MentalInfrastructure::LanePoint> intersectionPointB;
+    if (lanePointsA.size() < 2 || lanePointsB.size() < 2) {
+        return {intersectionPointA, intersectionPointB};
+    }
     for (auto pA1 = lanePointsA.begin(), pA2 = std::next(pA1); pA2 != lanePointsA.end(); pA1++, pA2++) {
         for (auto pB1 = lanePointsB.begin(), pB2 = std::next(pB1); pB2 != lanePointsB.end(); pB1++, pB2++) {
             if (auto result = IntersectionPoints(&(*pA1), &(*pA2), &(*pB1), &(*pB2))) {
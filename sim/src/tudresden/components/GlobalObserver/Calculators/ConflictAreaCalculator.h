@@ -37,8 +37,8 @@ private:
     CalculateConflictAreas(const MentalInfrastructure::Lane *currentLane, const MentalInfrastructure::Lane *junctionLane) const;
 
     std::pair<std::vector<MentalInfrastructure::LanePoint>, std::vector<MentalInfrastructure::LanePoint>>
-    CalculateLaneIntersectionPoints(const std::list<MentalInfrastructure::LanePoint> &lanePointsA,
-                                    const std::list<MentalInfrastructure::LanePoint> &lanePointsB) const;
+    CalculateLaneIntersectionPoints(const std::vector<MentalInfrastructure::LanePoint> &lanePointsA,
+                                    const std::vector<MentalInfrastructure::LanePoint> &lanePointsB) const;
 
 private:
     std::shared_ptr<InfrastructurePerception> infrastructurePerception;
@@ -0,0 +1,360 @@
+#include "InfrastructureCache.h"
+
+#include <QFile>
+#include <QSaveFile>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "common/MentalInfrastructure/Road.h"
+
+namespace GlobalObserver::Calculators {
+namespace {
+constexpr uint32_t CACHE_MAGIC = 0x43524444; // "DDRC"
+constexpr int32_t NO_INDEX = -1;
+
+/// FNV-1a, stable across platforms and processes (unlike std::hash)
+void HashBytes(uint64_t &hash, const void *data, std::size_t size) {
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    for (std::size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+}
+
+template <typename T>
+void HashValue(uint64_t &hash, const T &value) {
+    static_assert(std::is_arithmetic_v<T>);
+    HashBytes(hash, &value, sizeof(T));
+}
+
+void HashString(uint64_t &hash, const std::string &value) {
+    HashValue(hash, static_cast<uint32_t>(value.size()));
+    HashBytes(hash, value.data(), value.size());
+}
+
+void HashLanePoint(uint64_t &hash, const MentalInfrastructure::LanePoint &point) {
+    HashValue(hash, point.x);
+    HashValue(hash, point.y);
+    HashValue(hash, point.hdg);
+    HashValue(hash, point.sOffset);
+}
+
+class Writer {
+public:
+    template <typename T>
+    void Write(const T &value) {
+        static_assert(std::is_arithmetic_v<T>);
+        buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    void WriteString(const std::string &value) {
+        Write(static_cast<uint32_t>(value.size()));
+        buffer.append(value);
+    }
+
+    void WriteLanePoint(const MentalInfrastructure::LanePoint &point) {
+        Write(point.x);
+        Write(point.y);
+        Write(point.hdg);
+        Write(point.sOffset);
+    }
+
+    const std::string &GetBuffer() const {
+        return buffer;
+    }
+
+private:
+    std::string buffer;
+};
+
+/// reads from the mapped file, every read fails once the end is reached
+class Reader {
+public:
+    Reader(const uchar *data, qint64 size) : position{reinterpret_cast<const char *>(data)}, end{position + size} {
+    }
+
+    template <typename T>
+    bool Read(T &value) {
+        static_assert(std::is_arithmetic_v<T>);
+        if (end - position < static_cast<std::ptrdiff_t>(sizeof(T)))
+            return false;
+        std::memcpy(&value, position, sizeof(T));
+        position += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string &value) {
+        uint32_t size;
+        if (!Read(size) || end - position < static_cast<std::ptrdiff_t>(size))
+            return false;
+        value.assign(position, size);
+        position += size;
+        return true;
+    }
+
+    bool ReadLanePoint(MentalInfrastructure::LanePoint &point) {
+        return Read(point.x) && Read(point.y) && Read(point.hdg) && Read(point.sOffset);
+    }
+
+    /// reads a number of records, each record has at least one byte, so a larger number is a damaged file
+    bool ReadCount(uint32_t &count) {
+        return Read(count) && count <= static_cast<std::size_t>(end - position);
+    }
+
+private:
+    const char *position;
+    const char *end;
+};
+
+struct CachedConflictArea {
+    int32_t lane;
+    MentalInfrastructure::LanePoint start;
+    MentalInfrastructure::LanePoint end;
+};
+
+struct CachedConflictAreaPair {
+    OdId junctionId;
+    CachedConflictArea first;
+    CachedConflictArea second;
+};
+
+struct CachedStoppingPoint {
+    int32_t type;
+    int32_t road;
+    int32_t lane;
+    double sOffset;
+    double distanceToEgoFront;
+    double posX;
+    double posY;
+};
+
+struct CachedApproachLane {
+    int32_t lane;
+    std::vector<CachedStoppingPoint> stoppingPoints;
+};
+
+struct CachedJunction {
+    OdId junctionId;
+    std::vector<CachedApproachLane> approachLanes;
+};
+
+template <typename T>
+std::unordered_map<const T *, int32_t> IndexElements(const std::vector<std::shared_ptr<const T>> &elements) {
+    std::unordered_map<const T *, int32_t> indices;
+    for (std::size_t index = 0; index < elements.size(); index++) {
+        indices.emplace(elements.at(index).get(), static_cast<int32_t>(index));
+    }
+    return indices;
+}
+
+template <typename T>
+int32_t GetIndex(const std::unordered_map<const T *, int32_t> &indices, const T *element) {
+    if (element == nullptr)
+        return NO_INDEX;
+    return indices.at(element);
+}
+
+template <typename T>
+bool IsValidIndex(int32_t index, const std::vector<T> &elements, bool allowNoIndex) {
+    return (allowNoIndex && index == NO_INDEX) || (index >= 0 && static_cast<std::size_t>(index) < elements.size());
+}
+} // namespace
+
+uint64_t InfrastructureCache::CalculateKey(const std::string &sceneryPath) const {
+    QFile sceneryFile(QString::fromStdString(sceneryPath));
+    if (!sceneryFile.open(QIODevice::ReadOnly) || sceneryFile.size() == 0)
+        return 0;
+    const auto *sceneryData = sceneryFile.map(0, sceneryFile.size());
+    if (sceneryData == nullptr)
+        return 0;
+
+    uint64_t key = 0xcbf29ce484222325ULL;
+    HashValue(key, CACHE_VERSION);
+    HashBytes(key, sceneryData, static_cast<std::size_t>(sceneryFile.size()));
+
+    // the cache references lanes and roads by index, so their order and geometry are part of the key
+    HashValue(key, static_cast<uint64_t>(infrastructurePerception->roads.size()));
+    for (const auto &road : infrastructurePerception->roads) {
+        HashString(key, road->GetOpenDriveId());
+    }
+    HashValue(key, static_cast<uint64_t>(infrastructurePerception->lanes.size()));
+    for (const auto &lane : infrastructurePerception->lanes) {
+        HashString(key, lane->GetRoad()->GetOpenDriveId());
+        HashString(key, lane->GetOpenDriveId());
+        HashValue(key, lane->GetLength());
+        HashValue(key, static_cast<int>(lane->GetType()));
+        HashValue(key, lane->IsInRoadDirection());
+        HashValue(key, static_cast<uint64_t>(lane->GetLanePoints().size()));
+        if (!lane->GetLanePoints().empty()) {
+            HashLanePoint(key, lane->GetLanePoints().front());
+            HashLanePoint(key, lane->GetLanePoints().back());
+        }
+    }
+    return key == 0 ? 1 : key;
+}
+
+bool InfrastructureCache::Load(const std::string &sceneryPath) {
+    const auto key = CalculateKey(sceneryPath);
+    if (key == 0)
+        return false;
+
+    QFile cacheFile(QString::fromStdString(GetCachePath(sceneryPath)));
+    if (!cacheFile.open(QIODevice::ReadOnly) || cacheFile.size() == 0)
+        return false;
+    const auto *data = cacheFile.map(0, cacheFile.size());
+    if (data == nullptr)
+        return false;
+    Reader reader(data, cacheFile.size());
+
+    uint32_t magic;
+    uint32_t version;
+    uint64_t cachedKey;
+    if (!reader.Read(magic) || !reader.Read(version) || !reader.Read(cachedKey) || magic != CACHE_MAGIC || version != CACHE_VERSION ||
+        cachedKey != key)
+        return false;
+
+    // read everything before touching the InfrastructurePerception, a damaged file must not leave partial data behind
+    const auto &lanes = infrastructurePerception->lanes;
+    const auto &roads = infrastructurePerception->roads;
+    auto readConflictArea = [&reader, &lanes](CachedConflictArea &area) {
+        return reader.Read(area.lane) && IsValidIndex(area.lane, lanes, false) && reader.ReadLanePoint(area.start) &&
+               reader.ReadLanePoint(area.end);
+    };
+
+    uint32_t numberOfConflictAreas;
+    if (!reader.ReadCount(numberOfConflictAreas))
+        return false;
+    std::vector<CachedConflictAreaPair> conflictAreas(numberOfConflictAreas);
+    for (auto &conflictArea : conflictAreas) {
+        if (!reader.ReadString(conflictArea.junctionId) || !readConflictArea(conflictArea.first) || !readConflictArea(conflictArea.second))
+            return false;
+    }
+
+    uint32_t numberOfJunctions;
+    if (!reader.ReadCount(numberOfJunctions))
+        return false;
+    std::vector<CachedJunction> junctions(numberOfJunctions);
+    for (auto &junction : junctions) {
+        uint32_t numberOfApproachLanes;
+        if (!reader.ReadString(junction.junctionId) || !reader.ReadCount(numberOfApproachLanes))
+            return false;
+        junction.approachLanes.resize(numberOfApproachLanes);
+        for (auto &approachLane : junction.approachLanes) {
+            uint32_t numberOfStoppingPoints;
+            if (!reader.Read(approachLane.lane) || !IsValidIndex(approachLane.lane, lanes, false) || !reader.ReadCount(numberOfStoppingPoints))
+                return false;
+            approachLane.stoppingPoints.resize(numberOfStoppingPoints);
+            for (auto &sp : approachLane.stoppingPoints) {
+                if (!reader.Read(sp.type) || !reader.Read(sp.road) || !IsValidIndex(sp.road, roads, true) || !reader.Read(sp.lane) ||
+                    !IsValidIndex(sp.lane, lanes, true) || !reader.Read(sp.sOffset) || !reader.Read(sp.distanceToEgoFront) ||
+                    !reader.Read(sp.posX) || !reader.Read(sp.posY))
+                    return false;
+            }
+        }
+    }
+
+    // road and junction of a conflict area are the ones of its lane (see ConflictAreaCalculator)
+    auto toConflictArea = [&lanes](const CachedConflictArea &cachedArea) {
+        MentalInfrastructure::ConflictArea conflictArea;
+        conflictArea.lane = lanes.at(cachedArea.lane).get();
+        conflictArea.road = conflictArea.lane->GetRoad();
+        conflictArea.junction = conflictArea.road->GetJunction();
+        conflictArea.start = cachedArea.start;
+        conflictArea.end = cachedArea.end;
+        return conflictArea;
+    };
+    for (const auto &cachedPair : conflictAreas) {
+        auto conflictAreaPair = std::make_pair(toConflictArea(cachedPair.first), toConflictArea(cachedPair.second));
+        auto firstLane = const_cast<MentalInfrastructure::Lane *>(conflictAreaPair.first.lane);
+        auto secondLane = const_cast<MentalInfrastructure::Lane *>(conflictAreaPair.second.lane);
+        firstLane->AddConflictArea({secondLane, conflictAreaPair.first});
+        secondLane->AddConflictArea({firstLane, conflictAreaPair.second});
+        infrastructurePerception->conflictAreas[cachedPair.junctionId].push_back(std::move(conflictAreaPair));
+    }
+
+    StoppingPointData spData;
+    for (const auto &junction : junctions) {
+        auto &junctionStoppingPoints = spData.stoppingPoints[junction.junctionId];
+        for (const auto &approachLane : junction.approachLanes) {
+            auto &laneStoppingPoints = junctionStoppingPoints[lanes.at(approachLane.lane)->GetOwlId()];
+            for (const auto &cachedStoppingPoint : approachLane.stoppingPoints) {
+                StoppingPoint stoppingPoint;
+                stoppingPoint.type = static_cast<StoppingPointType>(cachedStoppingPoint.type);
+                stoppingPoint.road = cachedStoppingPoint.road == NO_INDEX ? nullptr : roads.at(cachedStoppingPoint.road).get();
+                stoppingPoint.lane = cachedStoppingPoint.lane == NO_INDEX ? nullptr : lanes.at(cachedStoppingPoint.lane).get();
+                stoppingPoint.sOffset = cachedStoppingPoint.sOffset;
+                stoppingPoint.distanceToEgoFront = cachedStoppingPoint.distanceToEgoFront;
+                stoppingPoint.posX = cachedStoppingPoint.posX;
+                stoppingPoint.posY = cachedStoppingPoint.posY;
+                laneStoppingPoints.insert({stoppingPoint.type, stoppingPoint});
+            }
+        }
+    }
+    infrastructurePerception->stoppingPointData = std::move(spData);
+    return true;
+}
+
+bool InfrastructureCache::Store(const std::string &sceneryPath) const {
+    const auto key = CalculateKey(sceneryPath);
+    if (key == 0)
+        return false;
+
+    const auto laneIndices = IndexElements(infrastructurePerception->lanes);
+    const auto roadIndices = IndexElements(infrastructurePerception->roads);
+
+    Writer writer;
+    writer.Write(CACHE_MAGIC);
+    writer.Write(CACHE_VERSION);
+    writer.Write(key);
+
+    auto writeConflictArea = [&writer, &laneIndices](const MentalInfrastructure::ConflictArea &conflictArea) {
+        writer.Write(GetIndex(laneIndices, conflictArea.lane));
+        writer.WriteLanePoint(conflictArea.start);
+        writer.WriteLanePoint(conflictArea.end);
+    };
+    uint32_t numberOfConflictAreas = 0;
+    for (const auto &[junctionId, conflictAreaPairs] : infrastructurePerception->conflictAreas) {
+        numberOfConflictAreas += static_cast<uint32_t>(conflictAreaPairs.size());
+    }
+    writer.Write(numberOfConflictAreas);
+    for (const auto &[junctionId, conflictAreaPairs] : infrastructurePerception->conflictAreas) {
+        for (const auto &[first, second] : conflictAreaPairs) {
+            writer.WriteString(junctionId);
+            writeConflictArea(first);
+            writeConflictArea(second);
+        }
+    }
+
+    const auto &stoppingPoints = infrastructurePerception->GetStoppingPointData().stoppingPoints;
+    writer.Write(static_cast<uint32_t>(stoppingPoints.size()));
+    for (const auto &[junctionId, approachLanes] : stoppingPoints) {
+        writer.WriteString(junctionId);
+        writer.Write(static_cast<uint32_t>(approachLanes.size()));
+        for (const auto &[laneId, laneStoppingPoints] : approachLanes) {
+            writer.Write(GetIndex(laneIndices, infrastructurePerception->lookupTableRoadNetwork.lanes.at(laneId)));
+            writer.Write(static_cast<uint32_t>(laneStoppingPoints.size()));
+            for (const auto &[type, stoppingPoint] : laneStoppingPoints) {
+                writer.Write(static_cast<int32_t>(stoppingPoint.type));
+                writer.Write(GetIndex(roadIndices, stoppingPoint.road));
+                writer.Write(GetIndex(laneIndices, stoppingPoint.lane));
+                writer.Write(stoppingPoint.sOffset);
+                writer.Write(stoppingPoint.distanceToEgoFront);
+                writer.Write(stoppingPoint.posX);
+                writer.Write(stoppingPoint.posY);
+            }
+        }
+    }
+
+    QSaveFile cacheFile(QString::fromStdString(GetCachePath(sceneryPath)));
+    const auto &buffer = writer.GetBuffer();
+    if (!cacheFile.open(QIODevice::WriteOnly) || cacheFile.write(buffer.data(), buffer.size()) != static_cast<qint64>(buffer.size()) ||
+        !cacheFile.commit()) {
+        std::cout << "Could not write infrastructure cache: " + GetCachePath(sceneryPath) << std::endl;
+        return false;
+    }
+    return true;
+}
+} // namespace GlobalObserver::Calculators
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "common/PerceptionData.h"
+
+namespace GlobalObserver::Calculators {
+
+/**
+ * @brief Stores the results of the ConflictAreaCalculator and the StoppingPointCalculator in a binary file next to the scenery, so
+ * further processes simulating the same scenery can skip these calculations.
+ *
+ * The file is only used if its key matches. The key is a hash of the OpenDRIVE file, the CACHE_VERSION and the converted lanes
+ * (ids, lengths and sampled geometry). Lanes and roads are referenced by their index in the InfrastructurePerception, which is
+ * identical for an identical key.
+ *
+ */
+class InfrastructureCache {
+public:
+    /**
+     * @brief Version of the file format and of the calculators. Must be incremented whenever the format or the results of the
+     * calculators (e.g. their thresholds) change.
+     *
+     */
+    static constexpr uint32_t CACHE_VERSION = 1;
+
+    InfrastructureCache(std::shared_ptr<InfrastructurePerception> infrastructurePerception) :
+        infrastructurePerception(infrastructurePerception) {
+    }
+
+    /**
+     * @brief Populates the conflict areas and stopping points of the InfrastructurePerception from the cache file of the scenery.
+     * Requires the converted road network.
+     *
+     * @param sceneryPath path of the OpenDRIVE file
+     * @return false if there is no valid cache file, the InfrastructurePerception is unchanged in this case
+     */
+    bool Load(const std::string &sceneryPath);
+
+    /**
+     * @brief Writes the conflict areas and stopping points of the InfrastructurePerception into the cache file of the scenery. The
+     * file is replaced atomically, so concurrently started processes never read a partially written file.
+     *
+     * @param sceneryPath path of the OpenDRIVE file
+     * @return false if the file could not be written
+     */
+    bool Store(const std::string &sceneryPath) const;
+
+private:
+    /**
+     * @brief Returns the key of the scenery file and the converted lanes or 0 if the scenery file cannot be read.
+     *
+     */
+    uint64_t CalculateKey(const std::string &sceneryPath) const;
+
+    static std::string GetCachePath(const std::string &sceneryPath) {
+        return sceneryPath + ".dreamcache";
+    }
+
+private:
+    std::shared_ptr<InfrastructurePerception> infrastructurePerception;
+};
+} // namespace GlobalObserver::Calculators
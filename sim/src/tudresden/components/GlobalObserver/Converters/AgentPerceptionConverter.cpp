@@ -1,5 +1,6 @@
 #include "AgentPerceptionConverter.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "WorldDataQuery.h"
@@ -7,11 +8,51 @@
 
 namespace GlobalObserver::Converters {
 void AgentPerceptionConverter::Populate() {
-    agentPerceptions.clear();
-    for (const auto &[id, agent] : world->GetAgents()) {
-        auto converted = ConvertAgent(agent);
-        agentPerceptions.insert({converted->id, converted});
+    const auto &agents = world->GetAgents();
+    for (auto iter = agentPerceptions.begin(); iter != agentPerceptions.end();) {
+        if (agents.find(iter->first) == agents.end()) {
+            agentRecords.erase(iter->first);
+            iter = agentPerceptions.erase(iter);
+        }
+        else {
+            ++iter;
+        }
+    }
+
+    for (const auto &[id, agent] : agents) {
+        auto &record = agentRecords[id];
+        auto &perception = agentPerceptions[id];
+        // release the perception of the previous timestep, so it can be reused if nobody else holds it
+        perception.reset();
+        perception = AcquirePerception(record);
+        ConvertAgent(agent, record, *perception);
+    }
+}
+
+std::shared_ptr<DetailedAgentPerception> AgentPerceptionConverter::AcquirePerception(AgentRecord &record) {
+    auto &pool = record.perceptionPool;
+    auto unused = std::find_if(pool.begin(), pool.end(), [](const auto &perception) { return perception.use_count() == 1; });
+    if (unused != pool.end()) {
+        return *unused;
+    }
+    pool.push_back(std::make_shared<DetailedAgentPerception>());
+    return pool.back();
+}
+
+const OWL::Interfaces::Lane &AgentPerceptionConverter::LocateLane(const WorldDataQuery &helper, LocatedLane &locatedLane,
+                                                                  const GlobalRoadPosition &position) const {
+    // sections overlap by the tolerance of Section::Covers, the query returns the first covering section there
+    constexpr double borderTolerance = 0.01;
+    const auto s = position.roadPosition.s;
+    if (locatedLane.lane != nullptr && locatedLane.laneId == position.laneId && locatedLane.roadId == position.roadId &&
+        locatedLane.lane->GetDistance(MeasurementPoint::RoadStart) + borderTolerance < s &&
+        s < locatedLane.lane->GetDistance(MeasurementPoint::RoadEnd)) {
+        return *locatedLane.lane;
     }
+
+    const auto &lane = helper.GetLaneByOdId(position.roadId, position.laneId, s);
+    locatedLane = {lane.Exists() ? &lane : nullptr, position.roadId, position.laneId};
+    return lane;
 }
 
 void AgentPerceptionConverter::SetInitialRoute(AgentInterface *agent, std::vector<GlobalObserver::Routes::InternWaypoint> route) {
@@ -58,13 +99,9 @@ DReaMRoute::Waypoints AgentPerceptionConverter::ConvertRoute(std::vector<GlobalO
     return dreamRoute;
 }
 
-bool AgentPerceptionConverter::CheckForRouteUpdate(const AgentInterface *agent) const {
+bool AgentPerceptionConverter::CheckForRouteUpdate(const AgentInterface *agent, const OWL::Interfaces::Lane &mainLocatorLane) const {
     const auto &egoAgent = const_cast<AgentInterface *>(agent)->GetEgoAgent();
-    auto worldData = static_cast<OWL::WorldData *>(world->GetWorldData());
-    WorldDataQuery helper(*worldData);
-
-    auto referenceLane = &helper.GetLaneByOdId(egoAgent.GetMainLocatePosition().roadId, egoAgent.GetMainLocatePosition().laneId,
-                                               egoAgent.GetMainLocatePosition().roadPosition.s);
+    auto referenceLane = &mainLocatorLane;
 
     auto normRad = std::fabs(std::fmod(agent->GetYaw() - egoAgent.GetLaneDirection(), (2 * M_PI)));
     auto absDiffDeg = std::min((2 * M_PI) - normRad, normRad);
@@ -183,29 +220,23 @@ Common::Vector2d AgentPerceptionConverter::GetDriverPosition(const AgentInterfac
     return driverPosition;
 }
 
-std::shared_ptr<DetailedAgentPerception> AgentPerceptionConverter::ConvertAgent(const AgentInterface *agent) {
-    DReaMRoute::Waypoints dreamRoute;
-    if (CheckForRouteUpdate(agent)) {
+void AgentPerceptionConverter::ConvertAgent(const AgentInterface *agent, AgentRecord &record, DetailedAgentPerception &perceptionData) {
+    const auto &actualEgoAgent = const_cast<AgentInterface *>(agent)->GetEgoAgent();
+    auto worldData = static_cast<OWL::WorldData *>(world->GetWorldData());
+    WorldDataQuery helper(*worldData);
+
+    auto mainLocatorLane = &LocateLane(helper, record.mainLocatorLane, actualEgoAgent.GetMainLocatePosition());
+
+    if (CheckForRouteUpdate(agent, *mainLocatorLane)) {
         auto newRouteOptional = RouteUpdate(agent);
         if (newRouteOptional.has_value()) {
-            dreamRoute = ConvertRoute(*newRouteOptional);
-            routeMapping.insert_or_assign(agent->GetId(), dreamRoute);
-        }
-        else {
-            dreamRoute = routeMapping.at(agent->GetId());
+            routeMapping.insert_or_assign(agent->GetId(), ConvertRoute(*newRouteOptional));
         }
     }
-    else {
-        dreamRoute = routeMapping.at(agent->GetId());
-    }
-    const auto &actualEgoAgent = const_cast<AgentInterface *>(agent)->GetEgoAgent();
+    const auto &dreamRoute = routeMapping.at(agent->GetId());
 
-    auto worldData = static_cast<OWL::WorldData *>(world->GetWorldData());
-
-    WorldDataQuery helper(*worldData);
-    auto referenceLane =
-        &helper.GetLaneByOdId(actualEgoAgent.GetReferencePointPosition()->roadId, actualEgoAgent.GetReferencePointPosition()->laneId,
-                              actualEgoAgent.GetReferencePointPosition()->roadPosition.s);
+    const auto referencePointPosition = actualEgoAgent.GetReferencePointPosition();
+    auto referenceLane = &LocateLane(helper, record.referenceLane, *referencePointPosition);
     if (!referenceLane || !referenceLane->Exists()) {
         auto msg = "File: " + static_cast<std::string>(__FILE__) + " Line: " + std::to_string(__LINE__) + " invalid lane ";
         throw std::runtime_error(msg);
@@ -213,18 +244,12 @@ std::shared_ptr<DetailedAgentPerception> AgentPerceptionConverter::ConvertAgent(
 
     auto referenceLaneDReaM = infrastructurePerception->lookupTableRoadNetwork.lanes.at(referenceLane->GetId());
 
-    auto mainLocatorLane =
-        &helper.GetLaneByOdId(actualEgoAgent.GetMainLocatePosition().roadId, actualEgoAgent.GetMainLocatePosition().laneId,
-                              actualEgoAgent.GetMainLocatePosition().roadPosition.s);
-
     if (!mainLocatorLane || !mainLocatorLane->Exists()) {
         auto msg = "File: " + static_cast<std::string>(__FILE__) + " Line: " + std::to_string(__LINE__) + " invalid lane ";
         throw std::runtime_error(msg);
     }
     auto mainLocatorLaneDReaM = infrastructurePerception->lookupTableRoadNetwork.lanes.at(mainLocatorLane->GetId());
 
-    DetailedAgentPerception perceptionData;
-
     // object information
     perceptionData.id = agent->GetId();
     perceptionData.yaw = agent->GetYaw();
@@ -241,17 +266,23 @@ std::shared_ptr<DetailedAgentPerception> AgentPerceptionConverter::ConvertAgent(
     perceptionData.distanceReferencePointToLeadingEdge = agent->GetDistanceReferencePointToLeadingEdge();
     perceptionData.acceleration = agent->GetAcceleration();
     perceptionData.velocity = agent->GetVelocity(VelocityScope::Absolute);
-    perceptionData.lanePosition = {referenceLaneDReaM,
-                                   referenceLaneDReaM->IsInRoadDirection()
-                                       ? actualEgoAgent.GetReferencePointPosition()->roadPosition.s
-                                       : referenceLaneDReaM->GetLength() - actualEgoAgent.GetReferencePointPosition()->roadPosition.s};
+    perceptionData.lanePosition = {referenceLaneDReaM, referenceLaneDReaM->IsInRoadDirection()
+                                                           ? referencePointPosition->roadPosition.s
+                                                           : referenceLaneDReaM->GetLength() - referencePointPosition->roadPosition.s};
     perceptionData.movingInLaneDirection =
         GeneralAgentPerception::IsMovingInLaneDirection(perceptionData.lanePosition.lane, perceptionData.yaw,
                                                         perceptionData.lanePosition.sCoordinate, perceptionData.velocity);
     perceptionData.brakeLight = agent->GetBrakeLight();
     perceptionData.indicatorState = agent->GetIndicatorState();
-    perceptionData.nextLane =
-        perceptionData.lanePosition.lane->NextLane(perceptionData.indicatorState, perceptionData.movingInLaneDirection);
+    if (record.lane != perceptionData.lanePosition.lane || record.indicatorState != perceptionData.indicatorState ||
+        record.movingInLaneDirection != perceptionData.movingInLaneDirection) {
+        record.lane = perceptionData.lanePosition.lane;
+        record.indicatorState = perceptionData.indicatorState;
+        record.movingInLaneDirection = perceptionData.movingInLaneDirection;
+        record.nextLane =
+            perceptionData.lanePosition.lane->NextLane(perceptionData.indicatorState, perceptionData.movingInLaneDirection);
+    }
+    perceptionData.nextLane = record.nextLane;
     perceptionData.junctionDistance = GeneralAgentPerception::CalculateJunctionDistance(
         perceptionData, perceptionData.lanePosition.lane->GetRoad(), perceptionData.lanePosition.lane);
 
@@ -268,7 +299,5 @@ std::shared_ptr<DetailedAgentPerception> AgentPerceptionConverter::ConvertAgent(
     };
 
     perceptionData.route = dreamRoute;
-
-    return std::make_shared<DetailedAgentPerception>(perceptionData);
 }
 } // namespace GlobalObserver::Converters
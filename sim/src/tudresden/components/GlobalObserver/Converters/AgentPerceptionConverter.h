@@ -2,9 +2,11 @@
 
 #include <map>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 
 #include "Routes/RouteConverter.h"
+#include "WorldDataQuery.h"
 #include "common/PerceptionData.h"
 #include "common/RoutePlanning/RouteCalculation.h"
 
@@ -24,7 +26,8 @@ public:
     }
 
     /**
-     * @brief Triggers the internal conversion logic and populates the list of agent perceptions.
+     * @brief Triggers the internal conversion logic and populates the list of agent perceptions. The perceptions are taken from a
+     * pool per agent, a perception is only overwritten once nobody references it anymore.
      *
      */
     void Populate();
@@ -37,13 +40,68 @@ public:
      */
     void SetInitialRoute(AgentInterface* agent, std::vector<GlobalObserver::Routes::InternWaypoint> route);
 
+    /**
+     * @brief Forgets the routes of all agents, agent ids are reused by the next invocation.
+     *
+     */
+    void Reset() {
+        routeMapping.clear();
+        agentRecords.clear();
+    }
+
 private:
+    /**
+     * @brief OWL lane found for a position in the previous conversion.
+     *
+     */
+    struct LocatedLane {
+        const OWL::Interfaces::Lane *lane = nullptr;
+        std::string roadId;
+        OWL::OdId laneId{};
+    };
+
+    /**
+     * @brief Data of an agent kept between two conversions.
+     *
+     */
+    struct AgentRecord {
+        LocatedLane referenceLane;
+        LocatedLane mainLocatorLane;
+
+        // input and result of the last Lane::NextLane call
+        const MentalInfrastructure::Lane *lane = nullptr;
+        IndicatorState indicatorState = IndicatorState::IndicatorState_Off;
+        bool movingInLaneDirection = false;
+        const MentalInfrastructure::Lane *nextLane = nullptr;
+
+        // perceptions of this and previous timesteps, drivers may keep the latter (memory, reaction time)
+        std::vector<std::shared_ptr<DetailedAgentPerception>> perceptionPool;
+    };
+
+    /**
+     * @brief Returns a perception of the pool of the agent that is not referenced anywhere else, adds one if there is none.
+     *
+     */
+    static std::shared_ptr<DetailedAgentPerception> AcquirePerception(AgentRecord &record);
+
     /**
      * @brief Converts a given agent into a DetailedAgentPerception.
      *
      * @param agent the agent to be converted
+     * @param record data of the previous conversion of the agent
+     * @param perceptionData perception to overwrite
+     */
+    void ConvertAgent(const AgentInterface *agent, AgentRecord &record, DetailedAgentPerception &perceptionData);
+
+    /**
+     * @brief Returns the OWL lane at a road position. The previously located lane is reused as long as the position stays inside of
+     * it, away from the borders shared with other sections.
+     *
+     * @param helper query for the world data
+     * @param locatedLane lane of the previous call, will be updated
+     * @param position the road position to locate
      */
-    std::shared_ptr<DetailedAgentPerception> ConvertAgent(const AgentInterface *agent);
+    const OWL::Interfaces::Lane &LocateLane(const WorldDataQuery &helper, LocatedLane &locatedLane, const GlobalRoadPosition &position) const;
 
     /**
      * @brief Calculates & returns the position of the driver inside the agent.
@@ -57,10 +115,11 @@ private:
      * their previous route.
      *
      * @param agent the agent to check
+     * @param mainLocatorLane OWL lane at the main locate position of the agent
      * @return true a new route needs to be picked
      * @return false no route update is required
      */
-    bool CheckForRouteUpdate(const AgentInterface *agent) const;
+    bool CheckForRouteUpdate(const AgentInterface *agent, const OWL::Interfaces::Lane &mainLocatorLane) const;
 
     /**
      * @brief Calculates a new route for an agent. Due to internal errors this might result in no route.
@@ -83,5 +142,6 @@ private:
 
     std::unordered_map<int, std::shared_ptr<DetailedAgentPerception>> &agentPerceptions;
     std::map<int, DReaMRoute::Waypoints> routeMapping{};
+    std::unordered_map<int, AgentRecord> agentRecords{};
 };
 } // namespace GlobalObserver::Converters
\ No newline at end of file
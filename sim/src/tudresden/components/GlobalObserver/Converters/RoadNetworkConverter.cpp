@@ -147,6 +147,7 @@ void RoadNetworkConverter::AddLaneGeometry(MentalInfrastructure::Lane *newLane,
     addLastPoint(lastlaneGeometry, referencePointType, addReferencePoint);
     addLastPoint(lastlaneGeometry, rightPointType, addRightPoint);
     addLastPoint(lastlaneGeometry, leftPointType, addLeftPoint);
+    newLane->FinishPoints();
 }
 
 const MentalInfrastructure::Road *RoadNetworkConverter::ConvertRoad(const OWL::Interfaces::Road *road) {
@@ -8,6 +8,7 @@ std::shared_ptr<Main> Main::instance = nullptr;
 int Main::runId = 0;
 ProfilesInterface *Main::profile = nullptr;
 std::string Main::scenarioConfigPath = "";
+std::string Main::sceneryPath = "";
 std::unordered_map<DReaMDefinitions::AgentVehicleType,
                    std::unordered_map<OdId, std::vector<std::pair<std::vector<Routes::InternWaypoint>, double>>>>
     Main::profileCatalogRouteDistributions{};
@@ -170,8 +171,12 @@ void Main::Trigger(int time) {
         // generating additional infrastructure data (conflict areas, stopping points, roadmap graph)
         if (!staticInfrastructureCreated) {
             rgCalculator.Populate();
-            spCalculator.Populate();
-            caCalculator.Populate();
+            // conflict areas and stopping points are expensive, they are calculated once per scenery and cached on disk
+            if (!infrastructureCache.Load(sceneryPath)) {
+                spCalculator.Populate();
+                caCalculator.Populate();
+                infrastructureCache.Store(sceneryPath);
+            }
             staticInfrastructureCreated = true;
         }
 
@@ -210,6 +215,13 @@ void Main::Trigger(int time) {
     }
 }
 
+void Main::ResetAgentState() {
+    agentPerceptions.clear();
+    apConverter.Reset();
+    agentPerceptionsCreated = false;
+    lastConversionTime = -1;
+}
+
 void Main::TriggerRoadNetworkConversion() {
     rnConverter.Populate();
 }
@@ -227,9 +239,11 @@ std::shared_ptr<DetailedAgentPerception> Main::GetDetailedAgentPerception(int ag
 
 std::vector<std::shared_ptr<GeneralAgentPerception>> Main::GetGeneralAgentPerception(std::vector<int> agentIds) {
     std::vector<std::shared_ptr<GeneralAgentPerception>> toReturn;
+    toReturn.reserve(agentIds.size());
     for (const auto &id : agentIds) {
-        if (agentPerceptions.find(id) != agentPerceptions.end()) {
-            toReturn.push_back(std::static_pointer_cast<GeneralAgentPerception>(agentPerceptions.at(id)));
+        auto perception = agentPerceptions.find(id);
+        if (perception != agentPerceptions.end()) {
+            toReturn.push_back(perception->second);
         }
     }
     return toReturn;
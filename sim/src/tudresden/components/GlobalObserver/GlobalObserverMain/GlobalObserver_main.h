@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "../Calculators/ConflictAreaCalculator.h"
+#include "../Calculators/InfrastructureCache.h"
 #include "../Calculators/RoadmapGraphCalculator.h"
 #include "../Calculators/StoppingPointCalculator.h"
 #include "../Converters/AgentPerceptionConverter.h"
@@ -42,11 +43,15 @@ namespace GlobalObserver {
  * @brief Singleton shared by all agents, provides the core GlobalObserver functionality. Will update internal components as needed
  * whenever the \code Trigger() \endcode method is invoked.
  *
+ * The static infrastructure (lanes, conflict areas, stopping points, roadmap graph and routes) only depends on the scenery and is
+ * therefore kept as long as the instance is requested for the same world. Between two invocations only the agent related state is
+ * reset (see \code ResetRun() \endcode).
+ *
  */
 class EXPORTMAIN Main {
 public:
     static std::shared_ptr<Main> GetInstance(WorldInterface *world, StochasticsInterface *stochastics) {
-        if (!instance)
+        if (!instance || instance->world != world)
             instance = std::shared_ptr<Main>(new Main(world, stochastics));
         return instance;
     }
@@ -59,13 +64,23 @@ public:
     Main &operator=(Main const &) = delete;
 
     /**
-     * @brief Resets the instance of GlobalObserver.
+     * @brief Resets the instance of GlobalObserver including the converted infrastructure.
      *
      */
     static void Reset() {
         instance.reset();
     }
 
+    /**
+     * @brief Resets the agent related state of the instance at the end of an invocation. The converted infrastructure is kept for the
+     * next invocation on the same world.
+     *
+     */
+    static void ResetRun() {
+        if (instance)
+            instance->ResetAgentState();
+    }
+
     /**
      * @brief Sets the current run ID.
      *
@@ -90,6 +105,14 @@ public:
         scenarioConfigPath = path;
     }
 
+    /**
+     * @brief Sets the path of the OpenDRIVE file, the infrastructure cache is stored next to it
+     *
+     */
+    static void SetSceneryPath(const std::string &path) {
+        sceneryPath = path;
+    }
+
     /**
      * @brief Triggers an update of the internally stored shared representations as well as the logic for detecting and categorizing crash
      * events.
@@ -147,6 +170,7 @@ private:
         caCalculator(infrastructurePerception),
         rgCalculator(infrastructurePerception),
         spCalculator(infrastructurePerception),
+        infrastructureCache(infrastructurePerception),
         apConverter(world, stochastics, infrastructurePerception, agentPerceptions),
         routeConverter(world) {
         profileCatalogRouteDistributions = ProfilesRouteConverter(profile);
@@ -158,12 +182,19 @@ private:
     ProfilesRouteConverter(ProfilesInterface *profile);
     std::unordered_map<std::string, std::vector<Routes::InternWaypoint>> ScenarioRouteConverter(std::string scenarioConfigPath);
 
+    /**
+     * @brief Clears the agent perceptions and routes of the finished invocation.
+     *
+     */
+    void ResetAgentState();
+
 private:
     // singleton related fields
     static std::shared_ptr<Main> instance;
     static int runId;
     static ProfilesInterface *profile;
     static std::string scenarioConfigPath;
+    static std::string sceneryPath;
     static std::unordered_map<DReaMDefinitions::AgentVehicleType,
                               std::unordered_map<OdId, std::vector<std::pair<std::vector<Routes::InternWaypoint>, double>>>>
         profileCatalogRouteDistributions;
@@ -179,6 +210,7 @@ private:
     GlobalObserver::Calculators::ConflictAreaCalculator caCalculator;
     GlobalObserver::Calculators::RoadmapGraphCalculator rgCalculator;
     GlobalObserver::Calculators::StoppingPointCalculator spCalculator;
+    GlobalObserver::Calculators::InfrastructureCache infrastructureCache;
     bool staticInfrastructureCreated = false;
 
     // agent perception related fields
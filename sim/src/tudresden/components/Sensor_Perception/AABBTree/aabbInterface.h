@@ -10,8 +10,22 @@
 #pragma once
 #include "aabb.h"
 
-struct AABBInterface {
+#include <memory>
+
+// index marking a missing node or an object that is not stored in any tree
+constexpr unsigned AABB_NULL_NODE = 0xffffffff;
+
+struct AABBInterface : std::enable_shared_from_this<AABBInterface> {
   public:
+    AABBInterface() = default;
+    // a copy is not stored in any tree
+    AABBInterface(const AABBInterface &other) : std::enable_shared_from_this<AABBInterface>(other) {}
+    AABBInterface &operator=(const AABBInterface &) { return *this; }
     virtual ~AABBInterface() = default;
     virtual AABB GetAABB() const = 0;
+
+  private:
+    friend class AABBTree;
+    // index of the leaf holding this object, an object can be stored in one tree at a time
+    unsigned treeNodeIndex = AABB_NULL_NODE;
 };
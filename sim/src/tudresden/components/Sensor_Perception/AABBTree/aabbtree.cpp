@@ -12,11 +12,19 @@
 #include <assert.h>
 #include <iostream>
 #include <stack>
-
-AABBTree::AABBTree(unsigned initialSize) :
-    rootNodeIndex{AABB_NULL_NODE}, allocatedNodeCount{0}, nextFreeNodeIndex{0}, nodeCapacity{initialSize}, growthSize{initialSize} {
+#include <stdexcept>
+
+AABBTree::AABBTree(unsigned initialSize, double fatMargin) :
+    rootNodeIndex{AABB_NULL_NODE},
+    allocatedNodeCount{0},
+    nextFreeNodeIndex{0},
+    nodeCapacity{initialSize},
+    growthSize{initialSize},
+    leafCount{0},
+    fatMargin{fatMargin} {
     assert(initialSize > 0);
     nodes.resize(initialSize);
+    nodeAABBs.resize(initialSize);
     for (unsigned nodeIndex = 0; nodeIndex < initialSize; nodeIndex++)
     {
         auto &node = nodes.at(nodeIndex);
@@ -38,6 +46,7 @@ unsigned AABBTree::AllocateNode()
 
         nodeCapacity += growthSize;
         nodes.resize(nodeCapacity);
+        nodeAABBs.resize(nodeCapacity);
 
         for (unsigned nodeIndex = allocatedNodeCount; nodeIndex < nodeCapacity; nodeIndex++)
         {
@@ -53,6 +62,7 @@ unsigned AABBTree::AllocateNode()
     allocatedNode.parentNodeIndex = AABB_NULL_NODE;
     allocatedNode.leftNodeIndex = AABB_NULL_NODE;
     allocatedNode.rightNodeIndex = AABB_NULL_NODE;
+    allocatedNode.object = nullptr;
     nextFreeNodeIndex = allocatedNode.nextNodeIndex;
     allocatedNodeCount++;
 
@@ -70,40 +80,50 @@ void AABBTree::DeAllocateNode(unsigned int nodeIndex)
 
 void AABBTree::InsertObject(const std::shared_ptr<AABBInterface> &object)
 {
-    auto nodeIndex = AllocateNode();
-    AABBNode &node = nodes.at(nodeIndex);
+    assert(object->treeNodeIndex == AABB_NULL_NODE);
 
-    node.aabb = object->GetAABB();
-    node.object = object;
+    auto nodeIndex = AllocateNode();
+    nodeAABBs.at(nodeIndex) = object->GetAABB();
+    nodes.at(nodeIndex).object = object.get();
 
     InsertLeaf(nodeIndex);
-    objectNodeIndexMap.insert({object, nodeIndex});
+    object->treeNodeIndex = nodeIndex;
+    leafCount++;
 }
 
 void AABBTree::RemoveObject(const std::shared_ptr<AABBInterface> &object)
 {
-    unsigned nodeIndex = objectNodeIndexMap.at(object);
+    unsigned nodeIndex = object->treeNodeIndex;
+    if (nodeIndex == AABB_NULL_NODE || nodes.at(nodeIndex).object != object.get())
+        throw std::out_of_range("AABBTree: object to remove is not stored in the tree");
+
     RemoveLeaf(nodeIndex);
     DeAllocateNode(nodeIndex);
-    objectNodeIndexMap.erase(object);
+    object->treeNodeIndex = AABB_NULL_NODE;
+    leafCount--;
 }
 
 void AABBTree::UpdateObject(const std::shared_ptr<AABBInterface> &object)
 {
-    if (objectNodeIndexMap.find(object) == objectNodeIndexMap.end())
+    if (object->treeNodeIndex == AABB_NULL_NODE)
     {
         InsertObject(object);
     }
 
-    unsigned nodeIndex = objectNodeIndexMap.at(object);
-    UpdateLeaf(nodeIndex, object->GetAABB());
+    UpdateLeaf(object->treeNodeIndex, object->GetAABB());
 }
 
 std::forward_list<std::shared_ptr<AABBInterface>> AABBTree::QueryOverlaps(const std::shared_ptr<AABBInterface> &object) const
+{
+    auto overlaps = QueryOverlaps(object->GetAABB());
+    overlaps.remove(object);
+    return overlaps;
+}
+
+std::forward_list<std::shared_ptr<AABBInterface>> AABBTree::QueryOverlaps(const AABB &testAABB) const
 {
     std::forward_list<std::shared_ptr<AABBInterface>> overlaps;
     std::stack<unsigned> stack;
-    AABB testAABB = object->GetAABB();
 
     stack.push(rootNodeIndex); // begin traversal at root node
     while (!stack.empty())
@@ -115,11 +135,13 @@ std::forward_list<std::shared_ptr<AABBInterface>> AABBTree::QueryOverlaps(const
             continue;
 
         const auto &node = nodes.at(nodeIndex);
-        if (node.aabb.Overlaps(testAABB))
+        if (nodeAABBs.at(nodeIndex).Overlaps(testAABB))
         {
-            if (node.IsLeaf() && node.object != object)
+            if (node.IsLeaf())
             {
-                overlaps.push_front(node.object);
+                // the box of a leaf may be enlarged by the fat margin
+                if (node.object->GetAABB().Overlaps(testAABB))
+                    overlaps.push_front(node.object->shared_from_this());
             }
             else
             {
@@ -134,8 +156,8 @@ std::forward_list<std::shared_ptr<AABBInterface>> AABBTree::QueryOverlaps(const
 
 std::shared_ptr<AABBInterface> AABBTree::FindClosestByRay(const Ray &ray, bool excludeFirst) const
 {
-    std::shared_ptr<AABBInterface> object = nullptr;
-    std::shared_ptr<AABBInterface> lastObject = nullptr;
+    AABBInterface *object = nullptr;
+    AABBInterface *lastObject = nullptr;
 
     double minDistance = __DBL_MAX__;
 
@@ -152,8 +174,10 @@ std::shared_ptr<AABBInterface> AABBTree::FindClosestByRay(const Ray &ray, bool e
 
         const auto &node = nodes.at(nodeIndex);
         double distance = -__DBL_MAX__;
+        // the box of a leaf may be enlarged by the fat margin, so leaves are tested with the exact box of their object
+        const auto aabb = node.IsLeaf() ? node.object->GetAABB() : nodeAABBs.at(nodeIndex);
 
-        if (node.aabb.HitsBox(ray, distance))
+        if (aabb.HitsBox(ray, distance))
         {
             if (node.IsLeaf() && distance < minDistance)
             {
@@ -168,7 +192,8 @@ std::shared_ptr<AABBInterface> AABBTree::FindClosestByRay(const Ray &ray, bool e
             }
         }
     }
-    return excludeFirst ? lastObject : object;
+    auto *result = excludeFirst ? lastObject : object;
+    return result ? result->shared_from_this() : nullptr;
 }
 
 std::list<std::pair<std::shared_ptr<AABBInterface>, double>> AABBTree::QueryRay(const Ray &ray) const
@@ -187,12 +212,14 @@ std::list<std::pair<std::shared_ptr<AABBInterface>, double>> AABBTree::QueryRay(
 
         auto &node = nodes.at(nodeIndex);
         double distance = -__DBL_MAX__;
+        // the box of a leaf may be enlarged by the fat margin, so leaves are tested with the exact box of their object
+        const auto aabb = node.IsLeaf() ? node.object->GetAABB() : nodeAABBs.at(nodeIndex);
 
-        if (node.aabb.HitsBox(ray, distance))
+        if (aabb.HitsBox(ray, distance))
         {
             if (node.IsLeaf())
             {
-                results.push_front(std::make_pair(node.object, distance));
+                results.push_front(std::make_pair(node.object->shared_from_this(), distance));
             }
             else
             {
@@ -222,27 +249,27 @@ void AABBTree::InsertLeaf(unsigned int leafNodeIndex)
         unsigned leftNodeIndex = nodes.at(treeNodeIndex).leftNodeIndex;
         unsigned rightNodeIndex = nodes.at(treeNodeIndex).rightNodeIndex;
 
-        AABB combinedAABB = nodes.at(treeNodeIndex).aabb.Merge(nodes.at(leafNodeIndex).aabb);
+        AABB combinedAABB = nodeAABBs.at(treeNodeIndex).Merge(nodeAABBs.at(leafNodeIndex));
 
         double newParentNodeCost = 2.0 * combinedAABB.surfaceArea;
-        double minimumPushDownCost = 2.0 * (combinedAABB.surfaceArea - nodes.at(treeNodeIndex).aabb.surfaceArea);
+        double minimumPushDownCost = 2.0 * (combinedAABB.surfaceArea - nodeAABBs.at(treeNodeIndex).surfaceArea);
 
         double costLeft, costRight;
         if (nodes.at(leftNodeIndex).IsLeaf()) {
-            costLeft = nodes.at(leafNodeIndex).aabb.Merge(nodes.at(leftNodeIndex).aabb).surfaceArea + minimumPushDownCost;
+            costLeft = nodeAABBs.at(leafNodeIndex).Merge(nodeAABBs.at(leftNodeIndex)).surfaceArea + minimumPushDownCost;
         }
         else
         {
-            AABB newLeftAabb = nodes.at(leafNodeIndex).aabb.Merge(nodes.at(leftNodeIndex).aabb);
-            costLeft = (newLeftAabb.surfaceArea - nodes.at(leftNodeIndex).aabb.surfaceArea) + minimumPushDownCost;
+            AABB newLeftAabb = nodeAABBs.at(leafNodeIndex).Merge(nodeAABBs.at(leftNodeIndex));
+            costLeft = (newLeftAabb.surfaceArea - nodeAABBs.at(leftNodeIndex).surfaceArea) + minimumPushDownCost;
         }
         if (nodes.at(rightNodeIndex).IsLeaf()) {
-            costRight = nodes.at(leafNodeIndex).aabb.Merge(nodes.at(rightNodeIndex).aabb).surfaceArea + minimumPushDownCost;
+            costRight = nodeAABBs.at(leafNodeIndex).Merge(nodeAABBs.at(rightNodeIndex)).surfaceArea + minimumPushDownCost;
         }
         else
         {
-            AABB newRightAabb = nodes.at(leafNodeIndex).aabb.Merge(nodes.at(rightNodeIndex).aabb);
-            costRight = (newRightAabb.surfaceArea - nodes.at(rightNodeIndex).aabb.surfaceArea) + minimumPushDownCost;
+            AABB newRightAabb = nodeAABBs.at(leafNodeIndex).Merge(nodeAABBs.at(rightNodeIndex));
+            costRight = (newRightAabb.surfaceArea - nodeAABBs.at(rightNodeIndex).surfaceArea) + minimumPushDownCost;
         }
 
         if (newParentNodeCost < costLeft && newParentNodeCost < costRight)
@@ -256,7 +283,7 @@ void AABBTree::InsertLeaf(unsigned int leafNodeIndex)
     unsigned newParentIndex = AllocateNode();
 
     nodes.at(newParentIndex).parentNodeIndex = oldParentIndex;
-    nodes.at(newParentIndex).aabb = nodes.at(leafNodeIndex).aabb.Merge(nodes.at(leafSiblingIndex).aabb);
+    nodeAABBs.at(newParentIndex) = nodeAABBs.at(leafNodeIndex).Merge(nodeAABBs.at(leafSiblingIndex));
     nodes.at(newParentIndex).leftNodeIndex = leafSiblingIndex;
     nodes.at(newParentIndex).rightNodeIndex = leafNodeIndex;
     nodes.at(leafNodeIndex).parentNodeIndex = newParentIndex;
@@ -329,13 +356,13 @@ void AABBTree::RemoveLeaf(unsigned int leafNodeIndex)
 
 void AABBTree::UpdateLeaf(unsigned int leafNodeIndex, const AABB &aabb)
 {
-    auto &node = nodes.at(leafNodeIndex);
+    auto &leafAABB = nodeAABBs.at(leafNodeIndex);
 
-    if (node.aabb.Contains(aabb))
+    if (leafAABB.Contains(aabb))
         return;
 
     RemoveLeaf(leafNodeIndex);
-    node.aabb = aabb;
+    leafAABB = AABB(aabb.minX - fatMargin, aabb.minY - fatMargin, aabb.maxX + fatMargin, aabb.maxY + fatMargin);
     InsertLeaf(leafNodeIndex);
 }
 
@@ -347,7 +374,7 @@ void AABBTree::FixUpwardsTree(unsigned treeNodeIndex)
 
         assert(treeNode.leftNodeIndex != AABB_NULL_NODE && treeNode.rightNodeIndex != AABB_NULL_NODE);
 
-        treeNode.aabb = nodes.at(treeNode.leftNodeIndex).aabb.Merge(nodes.at(treeNode.rightNodeIndex).aabb);
+        nodeAABBs.at(treeNodeIndex) = nodeAABBs.at(treeNode.leftNodeIndex).Merge(nodeAABBs.at(treeNode.rightNodeIndex));
         treeNodeIndex = treeNode.parentNodeIndex;
     }
 }
@@ -14,15 +14,16 @@
 
 #include <forward_list>
 #include <list>
-#include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
-#define AABB_NULL_NODE 0xffffffff
-
+///
+/// \brief Topology of a node, its box is stored separately in AABBTree::nodeAABBs.
+///
 struct AABBNode {
-    AABB aabb;
-    std::shared_ptr<AABBInterface> object = nullptr;
+    // not owning, the object must be removed from the tree before it is destroyed (nullptr for inner nodes)
+    AABBInterface *object = nullptr;
 
     unsigned parentNodeIndex;
     unsigned leftNodeIndex;
@@ -39,17 +40,22 @@ struct AABBNode {
 
 class AABBTree {
   public:
-    AABBTree(unsigned initialSize);
+    ///
+    /// \param initialSize  number of preallocated nodes
+    /// \param fatMargin    margin added to the box of a moved object, movements within the margin do not change the tree
+    ///
+    AABBTree(unsigned initialSize, double fatMargin = 0.0);
     ~AABBTree();
 
     void InsertObject(const std::shared_ptr<AABBInterface>& object);
     void RemoveObject(const std::shared_ptr<AABBInterface>& object);
     void UpdateObject(const std::shared_ptr<AABBInterface>& object);
     std::forward_list<std::shared_ptr<AABBInterface>> QueryOverlaps(const std::shared_ptr<AABBInterface>& object) const;
+    std::forward_list<std::shared_ptr<AABBInterface>> QueryOverlaps(const AABB& testAABB) const;
     std::list<std::pair<std::shared_ptr<AABBInterface>, double>> QueryRay(const Ray& ray) const;
     std::shared_ptr<AABBInterface> FindClosestByRay(const Ray& ray, bool excludeFirst = true) const;
 
-    int GetLeafElementCount() const { return objectNodeIndexMap.size(); }
+    int GetLeafElementCount() const { return leafCount; }
     int GetTotalElementCount() const { return nodes.size(); }
 
   private:
@@ -58,6 +64,8 @@ class AABBTree {
     unsigned nextFreeNodeIndex;
     unsigned nodeCapacity;
     unsigned growthSize;
+    unsigned leafCount;
+    double fatMargin;
 
     unsigned AllocateNode();
     void DeAllocateNode(unsigned nodeIndex);
@@ -67,6 +75,7 @@ class AABBTree {
     void FixUpwardsTree(unsigned treeNodeIndex);
 
   private:
-      std::map<std::shared_ptr<AABBInterface>, unsigned> objectNodeIndexMap{};
       std::vector<AABBNode> nodes{};
+      // boxes of the nodes, separate from the topology so the traversals only touch the boxes they test
+      std::vector<AABB> nodeAABBs{};
 };
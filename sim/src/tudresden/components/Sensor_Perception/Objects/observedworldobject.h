@@ -99,7 +99,7 @@ public:
         bool hit = false;
         for (unsigned i = 0; i < area.outer().size() - 1; i++) {
             Segment edge({area.outer().at(i).x(), area.outer().at(i).y()}, {area.outer().at(i + 1).x(), area.outer().at(i + 1).y()});
-            Segment raySegment({ray.origin.x, ray.origin.y}, {ray.direction.x * 1000, ray.direction.y * 1000});
+            Segment raySegment({ray.origin.x, ray.origin.y}, {ray.origin.x + ray.direction.x * 1000, ray.origin.y + ray.direction.y * 1000});
 
             std::vector<Point2d> output;
             boost::geometry::intersection(edge, raySegment, output);
@@ -48,7 +48,7 @@ void AABBTreeHandler::FirstExecution()
         auto agents = world->GetAgents();
 
         // initial tree generated (size = size of all objects in the world)
-        aabbTree = std::make_shared<AABBTree>(stationaryObjects.size() + trafficSigns.size() + agents.size());
+        aabbTree = std::make_shared<AABBTree>(stationaryObjects.size() + trafficSigns.size() + agents.size(), FAT_MARGIN);
 
         for (const auto &stationaryObject : stationaryObjects) {
             auto obj = std::make_shared<ObservedStaticObject>();
@@ -105,18 +105,10 @@ void AABBTreeHandler::FirstExecution()
         }
 
         for (const auto &[_, agent] : agents) {
-            auto obj = std::make_shared<ObservedDynamicObject>();
-            obj->area = ConstructPolygon(agent);
-            obj->RecalculateAABB();
-            obj->objectType = ObservedObjectType::MovingObject;
-            obj->id = agent->GetId();
-
-            aabbTree->InsertObject(obj);
-            this->agentsMapping.insert(std::make_pair(agent, obj));
-            this->agents.push_back(agent);
-            this->agentObjects.push_back(obj);
-            // this->agentsInversed.insert(std::make_pair(obj, agent));
+            AddAgent(agent);
         }
+        // the agents removed before are not part of the initial tree
+        processedRemovedAgents = world->GetRemovedAgents().size();
     }
 
     catch (const char *error) {
@@ -141,8 +133,57 @@ void AABBTreeHandler::FirstExecution()
     }
 }
 
+void AABBTreeHandler::AddAgent(AgentInterface *agent)
+{
+    auto obj = std::make_shared<ObservedDynamicObject>();
+    obj->area = ConstructPolygon(agent);
+    obj->RecalculateAABB();
+    obj->objectType = ObservedObjectType::MovingObject;
+    obj->id = agent->GetId();
+
+    aabbTree->InsertObject(obj);
+    agentSlots.insert(std::make_pair(agent->GetId(), agents.size()));
+    agents.push_back(agent);
+    agentObjects.push_back(obj);
+    agentPoses.push_back({agent->GetPositionX(), agent->GetPositionY(), agent->GetYaw()});
+}
+
+void AABBTreeHandler::RemoveAgent(int agentId)
+{
+    auto slot = agentSlots.find(agentId);
+    if (slot == agentSlots.end())
+        return;
+
+    const auto index = slot->second;
+    aabbTree->RemoveObject(agentObjects.at(index));
+    agentSlots.erase(slot);
+    agents.at(index) = nullptr;
+}
+
+void AABBTreeHandler::CompactAgents()
+{
+    std::size_t next = 0;
+    for (std::size_t index = 0; index < agents.size(); ++index) {
+        if (agents.at(index) == nullptr)
+            continue;
+
+        if (index != next) {
+            agents.at(next) = agents.at(index);
+            agentObjects.at(next) = std::move(agentObjects.at(index));
+            agentPoses.at(next) = agentPoses.at(index);
+            agentSlots.at(agents.at(next)->GetId()) = next;
+        }
+        ++next;
+    }
+    agents.resize(next);
+    agentObjects.resize(next);
+    agentPoses.resize(next);
+}
+
 std::shared_ptr<AABBTree> AABBTreeHandler::GetCurrentAABBTree(int timestamp)
 {
+    std::lock_guard<std::mutex> lock(updateMtx);
+
     if (firstExecution)
     {
         FirstExecution();
@@ -153,55 +194,36 @@ std::shared_ptr<AABBTree> AABBTreeHandler::GetCurrentAABBTree(int timestamp)
     if (timestamp <= currentTimestamp)
         return aabbTree;
 
-    auto worldAgents = world->GetAgents();
-
-    for (const auto &[_, agent] : worldAgents) {
-        if (agentsMapping.find(agent) != agentsMapping.end()) {
-            auto toUpdate = this->agentsMapping.at(agent);
-            toUpdate->area = ConstructPolygon(agent);
-            toUpdate->RecalculateAABB();
-            aabbTree->UpdateObject(toUpdate);
+    // the world keeps all agents removed in this run, so only the entries added since the last update are processed
+    const auto &removedAgents = world->GetRemovedAgents();
+    if (processedRemovedAgents < removedAgents.size()) {
+        for (; processedRemovedAgents < removedAgents.size(); ++processedRemovedAgents) {
+            RemoveAgent(removedAgents.at(processedRemovedAgents)->GetId());
         }
-        else
-        {
-            // if new agents are spawned
-            auto obj = std::make_shared<ObservedDynamicObject>();
-            obj->area = ConstructPolygon(agent);
-            obj->RecalculateAABB();
-            obj->objectType = ObservedObjectType::MovingObject;
-            obj->id = agent->GetId();
+        CompactAgents();
+    }
 
-            aabbTree->InsertObject(obj);
-            this->agentsMapping.insert(std::make_pair(agent, obj));
-            this->agents.push_back(agent);
-            this->agentObjects.push_back(obj);
+    // all removals are processed, so the world only has more agents if new agents were spawned
+    const auto &worldAgents = world->GetAgents();
+    if (worldAgents.size() != agents.size()) {
+        for (const auto &[id, agent] : worldAgents) {
+            if (agentSlots.find(id) == agentSlots.end())
+                AddAgent(agent);
         }
     }
-    // delete agents if they leave road network
-    for (auto iter = agentsMapping.begin(); iter != agentsMapping.end();)
-    {
-        if (std::none_of(worldAgents.begin(), worldAgents.end(),
-                         [iter](std::pair<int, AgentInterface *> element) { return element.second == iter->first; }))
-        {
-            agents.erase(std::remove_if(agents.begin(), agents.end(), [iter](AgentInterface *element) { return element == iter->first; }),
-                         agents.end());
-            auto agentObjectsIter =
-                std::find_if(agentObjects.begin(), agentObjects.end(),
-                             [iter](const std::shared_ptr<ObservedDynamicObject> &element) { return element->id == iter->first->GetId(); });
-
-            if (agentObjectsIter == agentObjects.end()) {
-                std::string message = "File: " + static_cast<std::string>(__FILE__) + " Line: " + std::to_string(__LINE__) +
-                                      " dynamic object does not exist in agentObjects map ";
-                throw std::runtime_error(message);
-            }
-            aabbTree->RemoveObject(*agentObjectsIter);
-            agentObjects.erase(agentObjectsIter);
-            iter = agentsMapping.erase(iter);
-        }
-        else
-        {
-            ++iter;
-        }
+
+    for (std::size_t index = 0; index < agents.size(); ++index) {
+        const auto agent = agents.at(index);
+        const AgentPose pose{agent->GetPositionX(), agent->GetPositionY(), agent->GetYaw()};
+        auto &lastPose = agentPoses.at(index);
+        if (pose == lastPose)
+            continue;
+
+        auto &toUpdate = agentObjects.at(index);
+        toUpdate->area = ConstructPolygon(agent);
+        toUpdate->RecalculateAABB();
+        aabbTree->UpdateObject(toUpdate);
+        lastPose = pose;
     }
 
     currentTimestamp = timestamp;
@@ -9,6 +9,7 @@
  *****************************************************************************/
 #pragma once
 
+#include <mutex>
 #include <unordered_map>
 
 #include "AABBTree/aabbtree.h"
@@ -37,8 +38,6 @@ public:
     }
 
 public:
-    std::unordered_map<AgentInterface *, std::shared_ptr<ObservedDynamicObject>> agentsMapping;
-
     std::vector<AgentInterface *> agents;
     std::vector<std::shared_ptr<ObservedDynamicObject>> agentObjects;
 
@@ -52,6 +51,21 @@ private:
 
     void FirstExecution();
 
+    ///
+    /// \brief Appends the agent to agents and agentObjects and inserts it into the tree.
+    ///
+    void AddAgent(AgentInterface *agent);
+
+    ///
+    /// \brief Removes the agent from the tree and clears its slot. Unknown ids are ignored.
+    ///
+    void RemoveAgent(int agentId);
+
+    ///
+    /// \brief Closes the slots cleared by RemoveAgent, the remaining agents keep their order.
+    ///
+    void CompactAgents();
+
     static Common::Vector2d RotatePointAroundPoint(Common::Vector2d input, Common::Vector2d pivot, double angle) {
         auto outputX = std::cos(angle) * (input.x - pivot.x) - std::sin(angle) * (input.y - pivot.y) + pivot.x;
         auto outputY = std::sin(angle) * (input.x - pivot.x) + std::cos(angle) * (input.y - pivot.y) + pivot.y;
@@ -145,4 +159,25 @@ private:
     int currentTimestamp = -__INT_MAX__;
     bool firstExecution = true;
     std::shared_ptr<AABBTree> aabbTree = nullptr;
+
+    struct AgentPose {
+        double x;
+        double y;
+        double yaw;
+
+        bool operator==(const AgentPose &other) const {
+            return x == other.x && y == other.y && yaw == other.yaw;
+        }
+    };
+    // agent id -> index into agents, agentObjects and agentPoses
+    std::unordered_map<int, std::size_t> agentSlots;
+    // pose of the agents when their polygon was built
+    std::vector<AgentPose> agentPoses;
+    // number of entries of the removed agents of the world that were already processed
+    std::size_t processedRemovedAgents = 0;
+    // movements of agents within this margin [m] do not change the structure of the tree
+    static constexpr double FAT_MARGIN = 1.0;
+
+    // sensors of agents executed in parallel request the tree concurrently
+    std::mutex updateMtx;
 };
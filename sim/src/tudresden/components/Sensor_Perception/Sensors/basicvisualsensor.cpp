@@ -9,56 +9,56 @@
  *****************************************************************************/
 #include "basicvisualsensor.h"
 
-#include <thread>
+#include <algorithm>
 
 void BasicVisualSensor::Trigger(int timestamp, GazeState gazeState) {
-    // use threads for operations
-    bool useThreads = false;
-
     sensorDirection = gazeState.directionUFOV;
     startPosUFOV = gazeState.startPosUFOV;
     minViewAngle = (-gazeState.openingAngle * (M_PI / 180)) / 2.0; // TODO: switch output visualization to radiant
     maxViewAngle = (gazeState.openingAngle * (M_PI / 180)) / 2.0;  // TODO: switch output visualization to radiant
 
     viewDistance = gazeState.viewDistance;
-    aabbTree = aabbTreeHandler->GetCurrentAABBTree(timestamp); // this updates the aabb tree (if needed)
-    visible.Clear();
-    ThreadedAgentPerception(useThreads);
+    const auto aabbTree = aabbTreeHandler->GetCurrentAABBTree(timestamp); // this updates the aabb tree (if needed)
+    occlusionMap = std::make_shared<const OcclusionMap>(*aabbTree, egoAgent->GetId(), startPosUFOV, sensorDirection,
+                                                        gazeState.openingAngle * (M_PI / 180), viewDistance);
+    ThreadedAgentPerception();
 }
 
-void BasicVisualSensor::ThreadedAgentPerception(bool useThreads) {
+void BasicVisualSensor::ThreadedAgentPerception() {
     auto nb_elements = aabbTreeHandler->agents.size();
 
     if (useThreads) {
-        unsigned nb_threads_hint = std::thread::hardware_concurrency();
-        unsigned nb_threads = nb_threads_hint == 0 ? 8 : (nb_threads_hint);
-
-        unsigned batch_size = nb_elements / nb_threads;
-        unsigned batch_remainder = nb_elements % nb_threads;
-
-        std::vector<std::thread> my_threads(nb_threads + 1);
-
-        // Multithread execution
-        for (unsigned i = 0; i < nb_threads; ++i) {
-            unsigned start = i * batch_size;
-            my_threads.at(i) = std::thread([this](unsigned s, unsigned e) { AgentPerceptionThread(s, e); }, start, start + batch_size);
+        auto &threadPool = ThreadPool::GetInstance();
+        slotVisibleIndices.resize(threadPool.GetNumberOfSlots());
+        for (auto &indices : slotVisibleIndices) {
+            indices.clear();
         }
 
-        // for all elements that are left
-        int start = nb_threads * batch_size;
-        my_threads.at(nb_threads) =
-            std::thread([this](unsigned s, unsigned e) { AgentPerceptionThread(s, e); }, start, start + batch_remainder);
+        threadPool.ParallelFor(nb_elements, [this](unsigned slot, std::size_t start, std::size_t end) {
+            AgentPerceptionThread(start, end, slotVisibleIndices.at(slot));
+        });
 
-        // Wait for the other thread to finish their task
-        std::for_each(my_threads.begin(), my_threads.end(), std::mem_fn(&std::thread::join));
+        // merge once and restore the agent order, so the result does not depend on the thread scheduling
+        auto &merged = slotVisibleIndices.front();
+        for (auto it = std::next(slotVisibleIndices.begin()); it != slotVisibleIndices.end(); ++it) {
+            merged.insert(merged.end(), it->begin(), it->end());
+        }
+        std::sort(merged.begin(), merged.end());
     }
     else {
-        AgentPerceptionThread(0, aabbTreeHandler->agents.size());
+        slotVisibleIndices.resize(1);
+        slotVisibleIndices.front().clear();
+        AgentPerceptionThread(0, nb_elements, slotVisibleIndices.front());
+    }
+
+    visible.clear();
+    for (auto index : slotVisibleIndices.front()) {
+        visible.push_back(aabbTreeHandler->agents.at(index)->GetId());
     }
 }
 
-void BasicVisualSensor::AgentPerceptionThread(unsigned startIndex, unsigned endIndex) {
-    for (unsigned k = startIndex; k < endIndex; k++) {
+void BasicVisualSensor::AgentPerceptionThread(std::size_t startIndex, std::size_t endIndex, std::vector<std::size_t> &visibleIndices) {
+    for (std::size_t k = startIndex; k < endIndex; k++) {
         const auto obj = aabbTreeHandler->agentObjects.at(k);
         const auto agent = aabbTreeHandler->agents.at(k);
 
@@ -72,10 +72,10 @@ void BasicVisualSensor::AgentPerceptionThread(unsigned startIndex, unsigned endI
         if ((otherPosition - startPosUFOV).Length() > viewDistance * 1.1)
             continue;
 
-        auto points = obj->area.outer();
+        const auto &points = obj->area.outer();
         bool hitAgent = false;
 
-        for (unsigned i = 0; i < points.size() - 1; i++) {
+        for (unsigned i = 0; i < points.size() - 1 && !hitAgent; i++) {
             auto currentPoint = Common::Vector2d(points.at(i).x(), points.at(i).y());
             auto nextPoint = Common::Vector2d(points.at(i + 1).x(), points.at(i + 1).y());
 
@@ -83,11 +83,9 @@ void BasicVisualSensor::AgentPerceptionThread(unsigned startIndex, unsigned endI
             auto distance = edge.Length();
             edge.Norm();
 
-            for (unsigned j = 0; j < subdivisions + 1; j++) {
+            for (unsigned j = 0; j < subdivisions + 1 && !hitAgent; j++) {
                 auto pointToCheck = currentPoint + (edge * ((distance / subdivisions) * j));
                 auto rayDirection = pointToCheck - startPosUFOV;
-
-                const Ray ray(startPosUFOV, rayDirection);
                 // transform point to local sensor funnel direction
                 rayDirection.Rotate(-sensorDirection);
 
@@ -98,44 +96,17 @@ void BasicVisualSensor::AgentPerceptionThread(unsigned startIndex, unsigned endI
                     continue;
 
                 // rule out points that are beyond viewing distance
-                if (rayDirection.Length() > viewDistance)
-                    continue;
-
-                // querying all objects that can possibly be hit by the ray
-                // these are sorted by distance from the driver so the following for finds a solution faster
-
-                const auto &queryResult = aabbTree->QueryRay(ray);
-
-                bool foundOccluding = false;
                 auto distanceToPoint = rayDirection.Length();
+                if (distanceToPoint > viewDistance)
+                    continue;
 
-                for (auto it = queryResult.begin(); it != queryResult.end(); ++it) {
-                    const auto obji = std::dynamic_pointer_cast<ObservedWorldObject>(it->first);
-                    const auto hitResult = obji->IsHitByRay(ray);
-
-                    if (hitResult < 0 || obji->id == egoAgent->GetId()) {
-                        continue;
-                    }
-
-                    if (hitResult < distanceToPoint && agent->GetId() != obji->id) {
-                        foundOccluding = true;
-                        break;
-                    }
-                }
-
-                hitAgent = !foundOccluding;
-
-                if (hitAgent)
-                    break;
+                hitAgent = occlusionMap->IsVisible(pointToCheck, agent->GetId());
             }
-
-            if (hitAgent)
-                break;
         }
 
         if (hitAgent) {
             // add it to the output list
-            visible.InsertElement(agent->GetId());
+            visibleIndices.push_back(k);
         }
     }
 }
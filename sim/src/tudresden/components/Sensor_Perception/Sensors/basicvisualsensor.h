@@ -9,15 +9,17 @@
  *****************************************************************************/
 #pragma once
 
-#include "Common/Threading/ThreadSafeContainer.h"
+#include "Common/Threading/ThreadPool.h"
 #include "aabbtreehandler.h"
 #include "common/globalDefinitions.h"
 #include "egoAgent.h"
+#include "visibilityservice.h"
 #include "visualsensorinterface.h"
 
 class BasicVisualSensor : public VisualSensorInterface<int> {
 public:
-    BasicVisualSensor(AgentInterface *egoAgent, WorldInterface *world) : VisualSensorInterface(egoAgent, world) {
+    BasicVisualSensor(AgentInterface *egoAgent, WorldInterface *world, bool useThreads = false) :
+        VisualSensorInterface(egoAgent, world), useThreads{useThreads} {
         aabbTreeHandler = AABBTreeHandler::GetInstance(world);
         worldData = static_cast<OWL::WorldData *>(world->GetWorldData());
     }
@@ -30,18 +32,29 @@ public:
     void Trigger(int timestamp, GazeState gazeState) override;
 
     std::vector<int> GetVisible() override {
-        return visible.RetrieveData();
+        return visible;
     }
 
 private:
-    void ThreadedAgentPerception(bool useThreads = true);
-    void AgentPerceptionThread(unsigned startIndex, unsigned endIndex);
+    ///
+    /// \brief Checks the visibility of all agents, distributed on the process-wide thread pool if useThreads is set.
+    ///
+    void ThreadedAgentPerception();
+
+    ///
+    /// \brief Checks the visibility of the agents [startIndex, endIndex) and appends the indices of the visible ones.
+    ///
+    void AgentPerceptionThread(std::size_t startIndex, std::size_t endIndex, std::vector<std::size_t> &visibleIndices);
 
 private:
     OWL::WorldData *worldData;
     std::shared_ptr<AABBTreeHandler> aabbTreeHandler;
-    std::shared_ptr<AABBTree> aabbTree = nullptr;
-    ThreadSafeVector<int> visible;
+    std::shared_ptr<const OcclusionMap> occlusionMap = nullptr;
+    std::vector<int> visible;
+
+    bool useThreads;
+    // indices of visible agents per thread pool slot, reused for each trigger
+    std::vector<std::vector<std::size_t>> slotVisibleIndices;
 
     double sensorDirection = 0;
     double minViewAngle = 0;
@@ -0,0 +1,195 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+#include "visibilityservice.h"
+
+#include <algorithm>
+#include <cmath>
+
+void OccluderGeometry::Add(const ObservedWorldObject &object) {
+    const auto &points = object.area.outer();
+    if (points.size() < 2)
+        return;
+
+    const auto firstEdge = static_cast<unsigned>(edgeStartX.size());
+    for (unsigned i = 0; i < points.size() - 1; i++) {
+        edgeStartX.push_back(points.at(i).x());
+        edgeStartY.push_back(points.at(i).y());
+        edgeEndX.push_back(points.at(i + 1).x());
+        edgeEndY.push_back(points.at(i + 1).y());
+    }
+    occluders.push_back({object.id, object.GetAABB(), firstEdge, static_cast<unsigned>(points.size() - 1)});
+}
+
+OcclusionMap::OcclusionMap(const AABBTree &tree, int observerId, const Common::Vector2d &origin, double direction,
+                           double openingAngle, double range) :
+    origin{origin} {
+    for (const auto &object : tree.QueryOverlaps(GetViewConeAABB(origin, direction, openingAngle, range))) {
+        const auto observedObject = dynamic_cast<const ObservedWorldObject *>(object.get());
+        if (observedObject == nullptr || observedObject->id == observerId)
+            continue;
+        geometry.Add(*observedObject);
+    }
+
+    struct Coverage {
+        unsigned firstBin;
+        unsigned numberOfBins;
+        Candidate candidate;
+    };
+    std::vector<Coverage> coverages;
+    std::vector<unsigned> binCount(NUMBER_OF_BINS, 0);
+
+    for (unsigned index = 0; index < geometry.occluders.size(); index++) {
+        const auto &occluder = geometry.occluders[index];
+
+        const auto &box = occluder.aabb;
+        const double dx = std::max({box.minX - origin.x, 0.0, origin.x - box.maxX});
+        const double dy = std::max({box.minY - origin.y, 0.0, origin.y - box.maxY});
+        const double minDistance = std::sqrt(dx * dx + dy * dy);
+        if (minDistance > range)
+            continue;
+
+        // angular extent of the silhouette, relative to the direction of the first corner
+        unsigned firstBin = 0;
+        unsigned numberOfBins = NUMBER_OF_BINS;
+        if (minDistance > 0.0) {
+            const double referenceAngle =
+                std::atan2(geometry.edgeStartY[occluder.firstEdge] - origin.y, geometry.edgeStartX[occluder.firstEdge] - origin.x);
+            double minDelta = 0.0;
+            double maxDelta = 0.0;
+            for (auto edge = occluder.firstEdge; edge < occluder.firstEdge + occluder.edgeCount; edge++) {
+                double delta = std::atan2(geometry.edgeStartY[edge] - origin.y, geometry.edgeStartX[edge] - origin.x) - referenceAngle;
+                if (delta > M_PI)
+                    delta -= 2 * M_PI;
+                else if (delta < -M_PI)
+                    delta += 2 * M_PI;
+                minDelta = std::min(minDelta, delta);
+                maxDelta = std::max(maxDelta, delta);
+            }
+
+            if (maxDelta - minDelta < M_PI) {
+                // one bin of margin on each side covers rounding at the bin borders
+                firstBin = (GetBin(referenceAngle + minDelta) + NUMBER_OF_BINS - 1) % NUMBER_OF_BINS;
+                const auto lastBin = (GetBin(referenceAngle + maxDelta) + 1) % NUMBER_OF_BINS;
+                numberOfBins = std::min(NUMBER_OF_BINS, (lastBin + NUMBER_OF_BINS - firstBin) % NUMBER_OF_BINS + 1);
+            }
+        }
+
+        coverages.push_back({firstBin, numberOfBins, {minDistance, index}});
+        for (unsigned i = 0; i < numberOfBins; i++) {
+            binCount[(firstBin + i) % NUMBER_OF_BINS]++;
+        }
+    }
+
+    binBegin.assign(NUMBER_OF_BINS + 1, 0);
+    for (unsigned bin = 0; bin < NUMBER_OF_BINS; bin++) {
+        binBegin[bin + 1] = binBegin[bin] + binCount[bin];
+    }
+
+    candidates.resize(binBegin.back());
+    std::vector<unsigned> next(binBegin.begin(), binBegin.end() - 1);
+    for (const auto &coverage : coverages) {
+        for (unsigned i = 0; i < coverage.numberOfBins; i++) {
+            candidates[next[(coverage.firstBin + i) % NUMBER_OF_BINS]++] = coverage.candidate;
+        }
+    }
+
+    // nearest occluders first, so a query can stop at the first candidate behind its point
+    for (unsigned bin = 0; bin < NUMBER_OF_BINS; bin++) {
+        std::sort(candidates.begin() + binBegin[bin], candidates.begin() + binBegin[bin + 1],
+                  [](const Candidate &a, const Candidate &b) { return a.minDistance < b.minDistance; });
+    }
+}
+
+unsigned OcclusionMap::GetBin(double angle) {
+    double normalised = std::fmod(angle + M_PI, 2 * M_PI);
+    if (normalised < 0.0)
+        normalised += 2 * M_PI;
+    return std::min(NUMBER_OF_BINS - 1, static_cast<unsigned>(normalised / (2 * M_PI) * NUMBER_OF_BINS));
+}
+
+double OcclusionMap::IntersectOccluder(const OccluderGeometry::Occluder &occluder, double directionX, double directionY) const {
+    double nearest = -1.0;
+    for (auto edge = occluder.firstEdge; edge < occluder.firstEdge + occluder.edgeCount; edge++) {
+        const double startX = geometry.edgeStartX[edge] - origin.x;
+        const double startY = geometry.edgeStartY[edge] - origin.y;
+        const double edgeX = geometry.edgeEndX[edge] - geometry.edgeStartX[edge];
+        const double edgeY = geometry.edgeEndY[edge] - geometry.edgeStartY[edge];
+
+        // solve origin + t * direction = start + s * edge
+        const double denominator = directionX * edgeY - directionY * edgeX;
+        if (std::abs(denominator) < 1e-12)
+            continue;
+
+        const double t = (startX * edgeY - startY * edgeX) / denominator;
+        const double s = (startX * directionY - startY * directionX) / denominator;
+        if (t >= 0.0 && s >= 0.0 && s <= 1.0 && (nearest < 0.0 || t < nearest)) {
+            nearest = t;
+        }
+    }
+    return nearest;
+}
+
+bool OcclusionMap::IsVisible(const Common::Vector2d &point, int targetId) const {
+    const double x = point.x - origin.x;
+    const double y = point.y - origin.y;
+    const double distance = std::sqrt(x * x + y * y);
+    if (distance == 0.0)
+        return true;
+
+    const double directionX = x / distance;
+    const double directionY = y / distance;
+    const auto bin = GetBin(std::atan2(y, x));
+
+    for (auto candidate = binBegin[bin]; candidate < binBegin[bin + 1]; candidate++) {
+        if (candidates[candidate].minDistance >= distance)
+            break;
+
+        const auto &occluder = geometry.occluders[candidates[candidate].occluder];
+        if (occluder.id == targetId)
+            continue;
+
+        const auto hit = IntersectOccluder(occluder, directionX, directionY);
+        if (hit >= 0.0 && hit < distance)
+            return false;
+    }
+    return true;
+}
+
+AABB OcclusionMap::GetViewConeAABB(const Common::Vector2d &origin, double direction, double openingAngle, double range) {
+    if (openingAngle >= 2 * M_PI)
+        return AABB(origin.x - range, origin.y - range, origin.x + range, origin.y + range);
+
+    const double halfOpeningAngle = openingAngle / 2;
+    double minX = origin.x;
+    double minY = origin.y;
+    double maxX = origin.x;
+    double maxY = origin.y;
+    auto include = [&](double angle) {
+        const double x = origin.x + range * std::cos(angle);
+        const double y = origin.y + range * std::sin(angle);
+        minX = std::min(minX, x);
+        minY = std::min(minY, y);
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+    };
+
+    include(direction - halfOpeningAngle);
+    include(direction + halfOpeningAngle);
+    // the arc bulges out to the axis directions it passes
+    for (int quadrant = 0; quadrant < 4; quadrant++) {
+        const double axisAngle = quadrant * M_PI / 2;
+        if (std::abs(std::remainder(axisAngle - direction, 2 * M_PI)) <= halfOpeningAngle)
+            include(axisAngle);
+    }
+    return AABB(minX, minY, maxX, maxY);
+}
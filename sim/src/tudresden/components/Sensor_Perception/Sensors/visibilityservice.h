@@ -0,0 +1,97 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+#pragma once
+
+#include <vector>
+
+#include "AABBTree/aabbtree.h"
+#include "Objects/observedworldobject.h"
+#include "common/vector2d.h"
+
+///
+/// \brief Edges of a set of occluding objects, stored as plain arrays.
+///
+struct OccluderGeometry {
+    struct Occluder {
+        int id;
+        AABB aabb;
+        unsigned firstEdge;
+        unsigned edgeCount;
+    };
+
+    std::vector<Occluder> occluders;
+    std::vector<double> edgeStartX;
+    std::vector<double> edgeStartY;
+    std::vector<double> edgeEndX;
+    std::vector<double> edgeEndY;
+
+    void Add(const ObservedWorldObject &object);
+};
+
+///
+/// \brief Angular occlusion map of one observer and its view cone.
+///
+/// The directions around the observer are divided into bins. Each bin lists the occluders within range whose
+/// silhouette covers the bin, sorted by their distance to the observer. A point is tested exactly against the
+/// edges of the occluders of its bin only, so the result equals a ray cast against all objects.
+///
+/// The occluders are the objects of the AABBTree overlapping the bounding box of the view cone. The tree is updated
+/// once per timestamp and shared by all observers, so only the objects near the observer are visited.
+///
+class OcclusionMap {
+public:
+    static constexpr unsigned NUMBER_OF_BINS = 720;
+
+    ///
+    /// \param tree          objects of the world at the current timestamp
+    /// \param observerId    id of the observing object, it does not occlude its own view
+    /// \param origin        position of the observer
+    /// \param direction     direction of the view cone [rad]
+    /// \param openingAngle  opening angle of the view cone [rad]
+    /// \param range         view distance
+    ///
+    OcclusionMap(const AABBTree &tree, int observerId, const Common::Vector2d &origin, double direction, double openingAngle,
+                 double range);
+
+    ///
+    /// \brief Returns true if the straight line from the observer to the point does not hit an occluder other than the target.
+    ///
+    /// Only points within the view cone are supported.
+    ///
+    bool IsVisible(const Common::Vector2d &point, int targetId) const;
+
+    ///
+    /// \brief Bounding box of the circular sector seen from the origin.
+    ///
+    static AABB GetViewConeAABB(const Common::Vector2d &origin, double direction, double openingAngle, double range);
+
+private:
+    struct Candidate {
+        double minDistance;
+        unsigned occluder;
+    };
+
+    static unsigned GetBin(double angle);
+
+    ///
+    /// \brief Distance along the normalised direction to the nearest edge of the occluder or a negative number if there is no hit.
+    ///
+    double IntersectOccluder(const OccluderGeometry::Occluder &occluder, double directionX, double directionY) const;
+
+    // occluders within range of the observer
+    OccluderGeometry geometry;
+    Common::Vector2d origin;
+    // candidates of bin i are candidates[binBegin[i], binBegin[i + 1])
+    std::vector<unsigned> binBegin;
+    std::vector<Candidate> candidates;
+};
@@ -27,7 +27,7 @@ public:
                                      PublisherInterface *const publisher, const CallbackInterface *callbacks, AgentInterface *agent) :
         SensorInterface(componentName, isInit, priority, offsetTime, responseTime, cycleTime, stochastics, world, parameters, publisher,
                         callbacks, agent),
-        sensorPerceptionLogic(agent, world) {
+        sensorPerceptionLogic(agent, world, IsThreadedPerception(parameters)) {
     }
     ~Sensor_Perception_Implementation() {
     }
@@ -61,6 +61,16 @@ public:
     virtual void Trigger(int time);
 
 private:
+    //-----------------------------------------------------------------------------
+    //! Reads the optional bool parameter "ThreadedPerception" (default false), which
+    //! distributes the visibility checks of the agents on the process-wide thread pool.
+    //-----------------------------------------------------------------------------
+    static bool IsThreadedPerception(const ParameterInterface *parameters) {
+        const auto &boolParameters = parameters->GetParametersBool();
+        const auto threadedPerception = boolParameters.find("ThreadedPerception");
+        return threadedPerception != boolParameters.end() && threadedPerception->second;
+    }
+
     SensorPerceptionLogic sensorPerceptionLogic;
     GazeState currentGazeState;
 };
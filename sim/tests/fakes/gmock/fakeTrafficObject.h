@@ -0,0 +1,24 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include "gmock/gmock.h"
+#include "fakeWorldObject.h"
+#include "include/trafficObjectInterface.h"
+
+class FakeTrafficObject : public FakeWorldObject, public TrafficObjectInterface
+{
+public:
+    MOCK_CONST_METHOD0(GetOpenDriveId, OpenDriveId());
+};
@@ -89,6 +89,7 @@ class FakeWorld : public WorldInterface
     MOCK_METHOD1(SetTimeOfDay, void(int timeOfDay));
     MOCK_METHOD1(SetWeekday, void(Weekday weekday));
     MOCK_METHOD1(SyncGlobalData, void(int timestamp));
+    MOCK_CONST_METHOD0(GetGeneration, std::size_t());
     MOCK_METHOD1(PublishGlobalData, void (int timestamp));
     MOCK_METHOD0(GetOsiGroundTruth, void*());
     MOCK_METHOD0(GetWorldData, void*());
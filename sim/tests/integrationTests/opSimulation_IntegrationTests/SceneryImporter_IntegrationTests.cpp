@@ -1109,6 +1109,56 @@ TEST(GetObjectsInRange_IntegrationTests, MultipleRoads)
     ASSERT_THAT(objectsInRange.at(1), Eq(world.GetAgent(1)));
 }
 
+TEST(GetRoadGraph_IntegrationTests, SameStartAndDepth_ReturnsCachedGraph)
+{
+    TESTSCENERY_FACTORY tsf;
+    ASSERT_THAT(tsf.instantiate("MultipleRoadsIntegrationScenery.xodr"), IsTrue());
+
+    auto& world = tsf.world;
+    const auto [firstGraph, firstRoot] = world.GetRoadGraph(RouteElement{"1", true}, 2);
+
+    // without the cache the start element could not be found anymore
+    auto worldData = static_cast<OWL::Interfaces::WorldData*>(world.GetWorldData());
+    worldData->SetRoadGraph(RoadGraph{}, RoadGraphVertexMapping{});
+
+    const auto [secondGraph, secondRoot] = world.GetRoadGraph(RouteElement{"1", true}, 2);
+    ASSERT_THAT(num_vertices(secondGraph), Eq(num_vertices(firstGraph)));
+    ASSERT_THAT(get(RouteElement(), secondGraph, secondRoot), Eq(get(RouteElement(), firstGraph, firstRoot)));
+}
+
+TEST(GetRoadGraph_IntegrationTests, DifferentDepth_IsFilteredSeparately)
+{
+    TESTSCENERY_FACTORY tsf;
+    ASSERT_THAT(tsf.instantiate("MultipleRoadsIntegrationScenery.xodr"), IsTrue());
+
+    auto& world = tsf.world;
+    const auto [shallowGraph, shallowRoot] = world.GetRoadGraph(RouteElement{"1", true}, 2);
+    const auto [deepGraph, deepRoot] = world.GetRoadGraph(RouteElement{"1", true}, 3);
+
+    ASSERT_THAT(num_vertices(shallowGraph), Eq(2));
+    ASSERT_THAT(num_vertices(deepGraph), Eq(3));
+}
+
+TEST(GetRoadGraph_IntegrationTests, CreateScenery_ClearsCachedGraphs)
+{
+    TESTSCENERY_FACTORY tsf;
+    ASSERT_THAT(tsf.instantiate("SceneryLeftLaneEnds.xodr"), IsTrue());
+
+    auto& world = tsf.world;
+    const auto [singleRoadGraph, singleRoadRoot] = world.GetRoadGraph(RouteElement{"1", true}, 2);
+    ASSERT_THAT(num_vertices(singleRoadGraph), Eq(1));
+
+    Scenery otherScenery;
+    std::filesystem::path sceneryPath = std::filesystem::current_path() / "Resources" / "ImporterTest" / "MultipleRoadsIntegrationScenery.xodr";
+    ASSERT_THAT(SceneryImporter::Import(sceneryPath.string(), &otherScenery), IsTrue());
+    NiceMock<FakeSceneryDynamics> sceneryDynamics;
+    ON_CALL(sceneryDynamics, GetEnvironment()).WillByDefault(Return(tsf.environment));
+    ASSERT_THAT(world.CreateScenery(&otherScenery, sceneryDynamics), IsTrue());
+
+    const auto [multipleRoadsGraph, multipleRoadsRoot] = world.GetRoadGraph(RouteElement{"1", true}, 2);
+    ASSERT_THAT(num_vertices(multipleRoadsGraph), Eq(2));
+}
+
 TEST(Locator_IntegrationTests, AgentOnStraightRoad_CalculatesCorrectLocateResult)
 {
     TESTSCENERY_FACTORY tsf;
@@ -58,8 +58,7 @@ TEST(AgentParser, RecurringComponent_IsParsed)
     ON_CALL(*fakeComponent, ReleaseFromLibrary()).WillByDefault(Return(true));
     testAgent.AddComponent("Compontent1", fakeComponent);
 
-    int currentTime = 0;
-    AgentParser agentParser(currentTime);
+    AgentParser agentParser;
     agentParser.Parse(testAgent);
 
     auto nonRecurringTasks = agentParser.GetNonRecurringTasks();
@@ -114,8 +113,7 @@ TEST(AgentParser, ThreeRecurringComponents_AreParsed)
     ON_CALL(*fakeComponent3, GetOutputLinks()).WillByDefault(ReturnRef(testChannels));
     testAgent.AddComponent("Compontent3", fakeComponent3);
 
-    int currentTime = 0;
-    AgentParser agentParser(currentTime);
+    AgentParser agentParser;
     agentParser.Parse(testAgent);
 
     auto nonRecurringTasks = agentParser.GetNonRecurringTasks();
@@ -153,8 +151,7 @@ TEST(AgentParser, NonRecurringComponent_IsParsed)
     ON_CALL(*fakeComponent, GetOutputLinks()).WillByDefault(ReturnRef(testChannels));
     testAgent.AddComponent("Compontent1", fakeComponent);
 
-    int currentTime = 0;
-    AgentParser agentParser(currentTime);
+    AgentParser agentParser;
     agentParser.Parse(testAgent);
 
     auto recurringTasks = agentParser.GetRecurringTasks();
@@ -200,8 +197,7 @@ TEST(AgentParser, MixedComponents_AreParsedWithRightTaskType)
     ON_CALL(*fakeComponent2, GetOutputLinks()).WillByDefault(ReturnRef(testChannels));
     testAgent.AddComponent("Compontent2", fakeComponent2);
 
-    int currentTime = 0;
-    AgentParser agentParser(currentTime);
+    AgentParser agentParser;
     agentParser.Parse(testAgent);
 
     auto recurringTasks = agentParser.GetRecurringTasks();
@@ -215,3 +211,39 @@ TEST(AgentParser, MixedComponents_AreParsedWithRightTaskType)
     EXPECT_THAT(nonRecurringTasks, Contains(Field(&TaskItem::taskType, Eq(TaskType::Trigger)))) << "taskType Trigger";
     EXPECT_THAT(nonRecurringTasks, Contains(Field(&TaskItem::taskType, Eq(TaskType::Update)))) << "taskType Update";
 }
+
+TEST(AgentParser, ParsedTasks_CallComponentMethodsWithGivenTime)
+{
+    NiceMock<FakeAgentBlueprint> fakeAgentBlueprint;
+    NiceMock<FakeWorld> fakeWorld;
+    EXPECT_CALL(fakeWorld, CreateAgentAdapter(_)).WillOnce(Return(ByMove(std::make_unique<FakeAgent>())));
+
+    Agent testAgent(&fakeWorld, fakeAgentBlueprint);
+
+    NiceMock<FakeComponent> fakeTargetComponent;
+    Channel testChannel(1);
+    testChannel.AddTarget(&fakeTargetComponent, 3);
+    std::map<int, Channel *> testChannels = {{2, &testChannel}};
+
+    auto fakeComponent = new NiceMock<FakeComponent>();
+    ON_CALL(*fakeComponent, GetPriority()).WillByDefault(Return(0));
+    ON_CALL(*fakeComponent, GetCycleTime()).WillByDefault(Return(100));
+    ON_CALL(*fakeComponent, GetOffsetTime()).WillByDefault(Return(0));
+    ON_CALL(*fakeComponent, GetResponseTime()).WillByDefault(Return(0));
+    ON_CALL(*fakeComponent, GetInit()).WillByDefault(Return(false));
+    ON_CALL(*fakeComponent, GetOutputLinks()).WillByDefault(ReturnRef(testChannels));
+    ON_CALL(*fakeComponent, ReleaseFromLibrary()).WillByDefault(Return(true));
+    testAgent.AddComponent("Compontent1", fakeComponent);
+
+    AgentParser agentParser;
+    agentParser.Parse(testAgent);
+
+    EXPECT_CALL(*fakeComponent, TriggerCycle(200)).WillOnce(Return(true));
+    EXPECT_CALL(*fakeComponent, AcquireOutputData(2, 200)).WillOnce(Return(true));
+    EXPECT_CALL(fakeTargetComponent, UpdateInputData(3, 200)).WillOnce(Return(true));
+
+    for (const auto &task : agentParser.GetRecurringTasks())
+    {
+        EXPECT_TRUE(task.Execute(200));
+    }
+}
@@ -9,11 +9,14 @@
  ********************************************************************************/
 #define OPENPASS_TESTING_ON
 
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <list>
 #include <set>
 
+#include "include/parameterInterface.h"
+#include "fakeComponent.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "schedulerTasks.h"
@@ -23,8 +26,10 @@ using ::testing::ContainerEq;
 using ::testing::Contains;
 using ::testing::Each;
 using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
 using ::testing::Eq;
 using ::testing::Field;
+using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::ReturnRef;
 using ::testing::SizeIs;
@@ -121,6 +126,59 @@ TEST(Tasks_Test, DeletedLastTasks_FilterTasksCorrect)
     ASSERT_TRUE(tasks.empty());
 }
 
+TEST(Tasks_Test, GetDueTasksOfMultipleSchedules_DeliversTasksInOrderOfTasks)
+{
+    std::function<bool(void)> triggerFunc = std::bind(&TriggerFunc, std::ref(currentTimestamp));
+    std::function<bool(void)> updateFunc = std::bind(&UpdateFunc, 0, std::ref(currentTimestamp));
+
+    TriggerTaskItem firstTaskItem{0, 0, 50, 0, triggerFunc};
+    TriggerTaskItem secondTaskItem{1, 10, 100, 0, triggerFunc};
+    UpdateTaskItem thirdTaskItem{0, 0, 100, 0, updateFunc};
+    TriggerTaskItem fourthTaskItem{1, 0, 100, 0, triggerFunc};
+    UpdateTaskItem fifthTaskItem{1, 10, 50, 0, updateFunc};
+    UpdateTaskItem sixthTaskItem{2, 0, 100, 10, updateFunc};
+
+    Tasks testTasks;
+    testTasks.AddTask(firstTaskItem);
+    testTasks.AddTask(secondTaskItem);
+    testTasks.AddTask(thirdTaskItem);
+    testTasks.AddTask(fourthTaskItem);
+    testTasks.AddTask(fifthTaskItem);
+    testTasks.AddTask(sixthTaskItem);
+
+    std::vector<TaskItem> dueTasks;
+    testTasks.GetDueTasks(100, dueTasks);
+
+    ASSERT_THAT(dueTasks, ElementsAre(secondTaskItem, fifthTaskItem, firstTaskItem, fourthTaskItem, thirdTaskItem));
+    ASSERT_THAT(dueTasks, ElementsAreArray(std::vector<TaskItem>(testTasks.tasks.begin(), std::prev(testTasks.tasks.end()))));
+
+    dueTasks.clear();
+    testTasks.GetDueTasks(50, dueTasks);
+
+    ASSERT_THAT(dueTasks, ElementsAre(fifthTaskItem, firstTaskItem));
+}
+
+TEST(Tasks_Test, DeletedTasks_RemovesSchedulesWithoutTasks)
+{
+    std::function<bool(void)> triggerFunc = std::bind(&TriggerFunc, std::ref(currentTimestamp));
+
+    TriggerTaskItem firstTaskItem{0, 0, 100, 0, triggerFunc};
+    TriggerTaskItem secondTaskItem{1, 10, 100, 0, triggerFunc};
+    TriggerTaskItem thirdTaskItem{1, 0, 50, 10, triggerFunc};
+
+    Tasks testTasks;
+    testTasks.AddTask(firstTaskItem);
+    testTasks.AddTask(secondTaskItem);
+    testTasks.AddTask(thirdTaskItem);
+
+    ASSERT_THAT(testTasks.GetSchedules(), ElementsAre(std::make_pair(50, 10), std::make_pair(100, 0)));
+
+    testTasks.DeleteTasks(1);
+
+    ASSERT_THAT(testTasks.GetSchedules(), ElementsAre(std::make_pair(100, 0)));
+    ASSERT_THAT(testTasks.tasks, ElementsAre(firstTaskItem));
+}
+
 TEST(SchedulerTasks_Test, ScheduleComponentTasks_UpdateScheduledTimestamps)
 {
     std::function<bool(void)> triggerFunc = std::bind(&TriggerFunc, std::ref(currentTimestamp));
@@ -516,3 +574,98 @@ TEST(SchedulerTasks_Test, UpdateTasks_ListedInCorrectOrder)
 
     ASSERT_THAT(taskItems, ElementsAre(outputTaskItem, inputTaskItem));
 }
+
+TEST(SchedulerTasks_Test, GetRecurringAgentTasksAsPointers_ReturnsSameTasksInSameOrder)
+{
+    std::function<bool(void)> triggerFunc = std::bind(&TriggerFunc, std::ref(currentTimestamp));
+
+    std::vector<TaskItem> taskItems{TriggerTaskItem{0, 1, 100, 0, triggerFunc},
+                                    TriggerTaskItem{1, 2, 200, 0, triggerFunc},
+                                    UpdateTaskItem{0, 1, 100, 0, triggerFunc},
+                                    TriggerTaskItem{2, 0, 100, 50, triggerFunc}};
+
+    SchedulerTasks testSchedulerTasks(std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, 200);
+    testSchedulerTasks.ScheduleNewRecurringTasks(taskItems);
+
+    std::vector<const TaskItem *> currentTasks{nullptr};
+    for (int timestamp : {0, 50, 100, 150, 200})
+    {
+        const auto expectedTasks = testSchedulerTasks.GetRecurringAgentTasks(timestamp);
+        testSchedulerTasks.GetRecurringAgentTasks(timestamp, currentTasks);
+
+        ASSERT_THAT(currentTasks, SizeIs(expectedTasks.size()));
+        for (std::size_t index = 0; index < currentTasks.size(); ++index)
+        {
+            EXPECT_THAT(*currentTasks[index], Eq(expectedTasks[index]));
+        }
+    }
+}
+
+namespace {
+
+//! component without behaviour, so only the scheduling overhead is measured
+class IdleComponent : public NiceMock<core::FakeComponent>
+{
+public:
+    bool TriggerCycle(int) override
+    {
+        return true;
+    }
+
+    bool AcquireOutputData(int, int) override
+    {
+        return true;
+    }
+
+    bool UpdateInputData(int, int) override
+    {
+        return true;
+    }
+};
+
+} // namespace
+
+TEST(DISABLED_SchedulerTasks_Benchmark, RecurringAgentTasksOf1000AgentsWith10Components)
+{
+    constexpr int numberOfAgents = 1000;
+    constexpr int numberOfComponents = 10;
+    constexpr int numberOfSteps = 1000;
+    constexpr int cycleTime = 100;
+
+    std::vector<IdleComponent> components(numberOfAgents * numberOfComponents);
+    std::vector<TaskItem> taskItems;
+    for (int agentId = 0; agentId < numberOfAgents; ++agentId)
+    {
+        for (int priority = 0; priority < numberOfComponents; ++priority)
+        {
+            auto *component = &components[agentId * numberOfComponents + priority];
+            taskItems.push_back(TriggerTaskItem{agentId, priority, cycleTime, 0, {component, ComponentTask::Operation::TriggerCycle}});
+            taskItems.push_back(UpdateTaskItem{agentId, priority, cycleTime, 0, {component, ComponentTask::Operation::AcquireOutputData, 0}});
+            taskItems.push_back(UpdateTaskItem{agentId, priority, cycleTime, 0, {component, ComponentTask::Operation::UpdateInputData, 0}});
+        }
+    }
+
+    SchedulerTasks testSchedulerTasks(std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, cycleTime);
+    testSchedulerTasks.ScheduleNewRecurringTasks(taskItems);
+
+    std::vector<const TaskItem *> currentTasks;
+    bool success = true;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int step = 0; step < numberOfSteps; ++step)
+    {
+        const int timestamp = step * cycleTime;
+        testSchedulerTasks.GetRecurringAgentTasks(timestamp, currentTasks);
+        for (const auto *task : currentTasks)
+        {
+            success &= task->Execute(timestamp);
+        }
+    }
+    const std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+
+    std::cout << "scheduling and dispatch of " << currentTasks.size() << " agent tasks: "
+              << duration.count() / numberOfSteps << " us per step" << std::endl;
+
+    EXPECT_TRUE(success);
+    EXPECT_THAT(currentTasks, SizeIs(taskItems.size()));
+}
@@ -10,6 +10,8 @@
 #include <functional>
 #include <iostream>
 #include <list>
+#include <map>
+#include <mutex>
 #include <set>
 
 #include "eventDetector.h"
@@ -29,6 +31,8 @@
 
 using namespace core::scheduling;
 
+using testing::ElementsAre;
+using testing::Eq;
 using testing::NiceMock;
 using testing::Return;
 using testing::ReturnRef;
@@ -93,3 +97,59 @@ TEST(DISABLED_Scheduler, RunWorks)
     RunResult runResult{};
     scheduler.Run(0, 300, runResult, fakeEventNetwork);
 }
+
+TEST(Scheduler, ExecuteAgentTasksWithMultipleThreads_KeepsOrderOfEachAgent)
+{
+    NiceMock<FakeWorld> fakeWorld;
+    NiceMock<FakeSpawnPointNetwork> fakeSpawnPointNetwork;
+    NiceMock<FakeDataBuffer> fakeDataBuffer;
+    NiceMock<FakeManipulatorNetwork> fakeManipulatorNetwork;
+    NiceMock<FakeObservationNetwork> fakeObservationNetwork;
+    NiceMock<FakeEventDetectorNetwork> fakeEventDetectorNetwork;
+
+    Scheduler scheduler(fakeWorld, fakeSpawnPointNetwork, fakeEventDetectorNetwork, fakeManipulatorNetwork, fakeObservationNetwork, fakeDataBuffer, 4);
+
+    std::mutex executionMutex;
+    std::map<int, std::vector<int>> executedPriorities;
+    auto createTask = [&](int agentId, int priority) {
+        return TriggerTaskItem(agentId, priority, 100, 0, [&executionMutex, &executedPriorities, agentId, priority] {
+            std::lock_guard<std::mutex> lock(executionMutex);
+            executedPriorities[agentId].push_back(priority);
+            return true;
+        });
+    };
+
+    std::vector<TaskItem> tasks;
+    for (int priority = 3; priority > 0; --priority)
+    {
+        for (int agentId = 0; agentId < 10; ++agentId)
+        {
+            tasks.push_back(createTask(agentId, priority));
+        }
+    }
+
+    ASSERT_TRUE(scheduler.ExecuteAgentTasks(tasks));
+    ASSERT_THAT(executedPriorities.size(), Eq(10));
+    for (const auto &[agentId, priorities] : executedPriorities)
+    {
+        EXPECT_THAT(priorities, ElementsAre(3, 2, 1));
+    }
+}
+
+TEST(Scheduler, ExecuteAgentTasksWithMultipleThreadsAndFailingTask_ReportsFailure)
+{
+    NiceMock<FakeWorld> fakeWorld;
+    NiceMock<FakeSpawnPointNetwork> fakeSpawnPointNetwork;
+    NiceMock<FakeDataBuffer> fakeDataBuffer;
+    NiceMock<FakeManipulatorNetwork> fakeManipulatorNetwork;
+    NiceMock<FakeObservationNetwork> fakeObservationNetwork;
+    NiceMock<FakeEventDetectorNetwork> fakeEventDetectorNetwork;
+
+    Scheduler scheduler(fakeWorld, fakeSpawnPointNetwork, fakeEventDetectorNetwork, fakeManipulatorNetwork, fakeObservationNetwork, fakeDataBuffer, 4);
+
+    std::vector<TaskItem> tasks{TriggerTaskItem(0, 1, 100, 0, [] { return true; }),
+                                TriggerTaskItem(1, 1, 100, 0, [] { return false; }),
+                                TriggerTaskItem(2, 1, 100, 0, [] { return true; })};
+
+    EXPECT_FALSE(scheduler.ExecuteAgentTasks(tasks));
+}
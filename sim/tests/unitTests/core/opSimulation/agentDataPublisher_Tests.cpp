@@ -46,3 +46,31 @@ TEST(AgentDataPublisher, CallingPublish_ForwardsParametersToDataBuffer)
 
     adp->Publish(key, value);
 }
+
+TEST(AgentDataPublisher, CallingPublishDeferred_ForwardsParametersToDataBufferOnFlushInOrder)
+{
+    FakeDataBuffer fakeDataBuffer;
+
+    const EntityId agentId = 1;
+    const Key firstKey = "firstKey";
+    const Key secondKey = "secondKey";
+    const Value firstValue = 2;
+    const Value secondValue = 3.0;
+
+    AgentDataPublisher adp(&fakeDataBuffer, agentId);
+    adp.SetDeferred(true);
+
+    EXPECT_CALL(fakeDataBuffer, PutCyclic(_, _, _)).Times(0);
+    adp.Publish(firstKey, firstValue);
+    adp.Publish(secondKey, secondValue);
+    ::testing::Mock::VerifyAndClearExpectations(&fakeDataBuffer);
+
+    ::testing::InSequence sequence;
+    EXPECT_CALL(fakeDataBuffer, PutCyclic(agentId, firstKey, firstValue));
+    EXPECT_CALL(fakeDataBuffer, PutCyclic(agentId, secondKey, secondValue));
+    adp.Flush();
+
+    ::testing::Mock::VerifyAndClearExpectations(&fakeDataBuffer);
+    EXPECT_CALL(fakeDataBuffer, PutCyclic(_, _, _)).Times(0);
+    adp.Flush();
+}
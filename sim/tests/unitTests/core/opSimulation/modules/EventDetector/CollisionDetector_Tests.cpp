@@ -0,0 +1,174 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <random>
+
+#include "fakeAgent.h"
+#include "fakeCallback.h"
+#include "fakeEventNetwork.h"
+#include "fakeTrafficObject.h"
+#include "fakeWorld.h"
+
+#include "common/events/collisionEvent.h"
+#include "CollisionDetector.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace
+{
+polygon_t CreateBox(double x, double y, double length, double width)
+{
+    return polygon_t{{{x, y}, {x + length, y}, {x + length, y + width}, {x, y + width}, {x, y}}};
+}
+
+class CollisionDetectorTest : public ::testing::Test
+{
+public:
+    CollisionDetectorTest()
+    {
+        ON_CALL(fakeWorld, GetAgents()).WillByDefault(ReturnRef(agentMap));
+        ON_CALL(fakeWorld, GetTrafficObjects()).WillByDefault(ReturnRef(trafficObjects));
+        ON_CALL(fakeEventNetwork, InsertEvent(_)).WillByDefault(Invoke([this](SharedEvent event)
+        {
+            const auto collisionEvent = std::dynamic_pointer_cast<openpass::events::CollisionEvent>(event);
+            ASSERT_TRUE(collisionEvent);
+            detectedCollisions.emplace_back(collisionEvent->collisionAgentId, collisionEvent->collisionOpponentId);
+        }));
+    }
+
+    void AddAgent(int id, polygon_t boundingBox)
+    {
+        boundingBoxes.push_back(std::make_unique<polygon_t>(std::move(boundingBox)));
+        auto &agent = fakeAgents.emplace_back(std::make_unique<NiceMock<FakeAgent>>());
+        ON_CALL(*agent, GetId()).WillByDefault(Return(id));
+        ON_CALL(*agent, GetType()).WillByDefault(Return(ObjectTypeOSI::Vehicle));
+        ON_CALL(*agent, GetBoundingBox2D()).WillByDefault(ReturnRef(*boundingBoxes.back()));
+        ON_CALL(*agent, GetCollisionPartners()).WillByDefault(Return(std::vector<CollisionPartner>{}));
+        agentMap.emplace(id, agent.get());
+    }
+
+    void AddTrafficObject(int id, polygon_t boundingBox)
+    {
+        boundingBoxes.push_back(std::make_unique<polygon_t>(std::move(boundingBox)));
+        auto &trafficObject = fakeTrafficObjects.emplace_back(std::make_unique<NiceMock<FakeTrafficObject>>());
+        ON_CALL(*trafficObject, GetId()).WillByDefault(Return(id));
+        ON_CALL(*trafficObject, GetType()).WillByDefault(Return(ObjectTypeOSI::Object));
+        ON_CALL(*trafficObject, GetBoundingBox2D()).WillByDefault(ReturnRef(*boundingBoxes.back()));
+        trafficObjects.push_back(trafficObject.get());
+    }
+
+    NiceMock<FakeWorld> fakeWorld;
+    NiceMock<FakeEventNetwork> fakeEventNetwork;
+    NiceMock<FakeCallback> fakeCallback;
+
+    std::map<int, AgentInterface*> agentMap;
+    std::vector<const TrafficObjectInterface*> trafficObjects;
+    std::vector<std::unique_ptr<NiceMock<FakeAgent>>> fakeAgents;
+    std::vector<std::unique_ptr<NiceMock<FakeTrafficObject>>> fakeTrafficObjects;
+    std::vector<std::unique_ptr<polygon_t>> boundingBoxes;
+
+    std::vector<std::pair<int, int>> detectedCollisions;
+};
+} // namespace
+
+TEST_F(CollisionDetectorTest, Trigger_InsertsEventsOnlyForOverlappingAgents)
+{
+    AddAgent(0, CreateBox(0.0, 0.0, 5.0, 2.0));
+    AddAgent(1, CreateBox(4.0, 1.0, 5.0, 2.0));
+    AddAgent(2, CreateBox(10.0, 0.0, 5.0, 2.0));
+    AddAgent(3, CreateBox(0.0, 5.0, 5.0, 2.0));
+
+    CollisionDetector collisionDetector(&fakeWorld, &fakeEventNetwork, &fakeCallback, nullptr);
+    collisionDetector.Trigger(0);
+
+    ASSERT_THAT(detectedCollisions, ::testing::ElementsAre(std::make_pair(0, 1)));
+}
+
+TEST_F(CollisionDetectorTest, Trigger_InsertsSameEventsInSameOrderAsTestingAllPairs)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> position(0.0, 200.0);
+    for (int id = 0; id < 300; ++id)
+    {
+        AddAgent(id, CreateBox(position(generator), position(generator) / 10.0, 5.0, 2.0));
+    }
+
+    CollisionDetector collisionDetector(&fakeWorld, &fakeEventNetwork, &fakeCallback, nullptr);
+
+    std::vector<std::pair<int, int>> expectedCollisions;
+    for (auto it = agentMap.cbegin(); it != agentMap.cend(); ++it)
+    {
+        for (auto otherIt = std::next(it); otherIt != agentMap.cend(); ++otherIt)
+        {
+            if (collisionDetector.DetectCollision(otherIt->second, it->second))
+            {
+                expectedCollisions.emplace_back(it->first, otherIt->first);
+            }
+        }
+    }
+
+    collisionDetector.Trigger(0);
+
+    ASSERT_THAT(expectedCollisions, ::testing::Not(::testing::IsEmpty()));
+    ASSERT_THAT(detectedCollisions, ::testing::ContainerEq(expectedCollisions));
+}
+
+TEST_F(CollisionDetectorTest, Trigger_InsertsSameTrafficObjectEventsInSameOrderAsTestingAllPairs)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> position(-100.0, 300.0);
+    for (int id = 0; id < 100; ++id)
+    {
+        AddAgent(id, CreateBox(position(generator), position(generator) / 10.0, 5.0, 2.0));
+    }
+    // objects on the borders of and spanning several grid cells
+    for (int id = 100; id < 400; ++id)
+    {
+        AddTrafficObject(id, CreateBox(position(generator), position(generator) / 10.0, 1.0 + (id % 4) * 15.0, 1.0 + (id % 3) * 10.0));
+    }
+    AddTrafficObject(400, CreateBox(-20.0, -0.5, 20.0, 1.0));
+    AddTrafficObject(401, CreateBox(0.0, 0.0, 40.0, 20.0));
+    AddTrafficObject(402, CreateBox(-1.0e5, -1.0, 2.0e5, 2.0));
+
+    CollisionDetector collisionDetector(&fakeWorld, &fakeEventNetwork, &fakeCallback, nullptr);
+
+    std::vector<std::pair<int, int>> expectedCollisions;
+    for (auto it = agentMap.cbegin(); it != agentMap.cend(); ++it)
+    {
+        for (auto otherIt = std::next(it); otherIt != agentMap.cend(); ++otherIt)
+        {
+            if (collisionDetector.DetectCollision(otherIt->second, it->second))
+            {
+                expectedCollisions.emplace_back(it->first, otherIt->first);
+            }
+        }
+        for (const auto trafficObject : trafficObjects)
+        {
+            if (collisionDetector.DetectCollision(trafficObject, it->second))
+            {
+                expectedCollisions.emplace_back(it->first, trafficObject->GetId());
+            }
+        }
+    }
+
+    collisionDetector.Trigger(0);
+
+    ASSERT_THAT(expectedCollisions, ::testing::Not(::testing::IsEmpty()));
+    ASSERT_THAT(detectedCollisions, ::testing::ContainerEq(expectedCollisions));
+}
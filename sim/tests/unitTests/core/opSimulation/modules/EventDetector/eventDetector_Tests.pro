@@ -31,14 +31,17 @@ INCLUDEPATH += \
 
 HEADERS += \
     $$HDR_COMMONS \
+    $$UNIT_UNDER_TEST/CollisionDetector.h \
     $$UNIT_UNDER_TEST/ConditionalEventDetector.h \
     $$UNIT_UNDER_TEST/EventDetectorCommonBase.h \
     $$CONDITIONS/ConditionCommonBase.h \
     $$OPEN_SRC/common/eventDetectorDefinitions.h
 
 SOURCES += \
+    $$UNIT_UNDER_TEST/CollisionDetector.cpp \
     $$UNIT_UNDER_TEST/ConditionalEventDetector.cpp \
     $$UNIT_UNDER_TEST/EventDetectorCommonBase.cpp \
     $$OPEN_SRC/common/commonTools.cpp \
     $$OPEN_SRC/common/eventDetectorDefinitions.cpp \
+    CollisionDetector_Tests.cpp \
     ConditionalEventDetector_Tests.cpp
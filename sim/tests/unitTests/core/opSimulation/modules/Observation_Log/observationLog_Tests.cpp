@@ -116,6 +116,128 @@ TEST(ObservationCyclics_Test, GetSamplesLineSamplesNotUntilEnd_ReturnsLineWithEm
     ASSERT_THAT(samplesLine, Eq(", 789, "));
 }
 
+TEST(ObservationCyclics_Test, InsertTypedValues_FormatsValuesLikeFlatParameter)
+{
+    ObservationCyclics cyclics;
+    const auto velocity = cyclics.GetColumnId("Velocity");
+    const auto lane = cyclics.GetColumnId("Lane");
+    const auto road = cyclics.GetColumnId("Road");
+    cyclics.Insert(0, 1, velocity, 12.5);
+    cyclics.Insert(0, 1, lane, -1);
+    cyclics.Insert(0, 12, road, std::string{"R1"});
+    cyclics.Insert(100, 1, velocity, 13.0);
+    cyclics.Insert(100, 12, road, std::vector<int>{1, 2});
+
+    ASSERT_THAT(cyclics.GetHeader(), Eq("01:Lane, 01:Velocity, 12:Road"));
+    ASSERT_THAT(cyclics.GetSamplesLine(0), Eq("-1, 12.500000, R1"));
+    ASSERT_THAT(cyclics.GetSamplesLine(1), Eq(", 13.000000, 1,2"));
+}
+
+TEST(ObservationCyclics_Test, InsertTypedValuesWithChangingType_KeepsPreviousValues)
+{
+    ObservationCyclics cyclics;
+    const auto value = cyclics.GetColumnId("Value");
+    cyclics.Insert(0, 0, value, 1);
+    cyclics.Insert(100, 0, value, 2.5);
+    cyclics.Insert(200, 0, value, true);
+
+    ASSERT_THAT(cyclics.GetSamplesLine(0), Eq("1"));
+    ASSERT_THAT(cyclics.GetSamplesLine(1), Eq("2.500000"));
+    ASSERT_THAT(cyclics.GetSamplesLine(2), Eq("1"));
+}
+
+TEST(ObservationCyclics_Test, InsertTypedValuesAddedAfterAndMissingInBetween_ReturnsLineWithEmptyString)
+{
+    ObservationCyclics cyclics;
+    const auto value = cyclics.GetColumnId("Value");
+    cyclics.Insert(0, 0, value, 1);
+    cyclics.Insert(100, 0, value, 2);
+    cyclics.Insert(100, 1, value, 3);
+    cyclics.Insert(200, 0, value, 4);
+    cyclics.Insert(300, 1, value, 5);
+    cyclics.Insert(300, 1, value, std::vector<double>{});
+
+    ASSERT_THAT(cyclics.GetSamplesLine(0), Eq("1, "));
+    ASSERT_THAT(cyclics.GetSamplesLine(1), Eq("2, 3"));
+    ASSERT_THAT(cyclics.GetSamplesLine(2), Eq("4, "));
+    ASSERT_THAT(cyclics.GetSamplesLine(3), Eq(", 5"));
+}
+
+TEST(ObservationCyclics_Test, Clear_KeepsColumnIds)
+{
+    ObservationCyclics cyclics;
+    const auto value = cyclics.GetColumnId("Value");
+    cyclics.Insert(0, 0, value, 1);
+    cyclics.Clear();
+
+    ASSERT_THAT(cyclics.GetColumnId("Value"), Eq(value));
+    ASSERT_THAT(cyclics.GetHeader(), Eq(""));
+    ASSERT_THAT(cyclics.GetTimeSteps(), ::testing::IsEmpty());
+}
+
+namespace
+{
+void InsertRun(ObservationCyclics& cyclics, int numberOfTimeSteps)
+{
+    const auto position = cyclics.GetColumnId("Position");
+    const auto name = cyclics.GetColumnId("Name");
+    for (int timeStep = 0; timeStep < numberOfTimeSteps; ++timeStep)
+    {
+        for (int agent = 0; agent < 12; ++agent)
+        {
+            // agents appear and disappear during the run, some values are missing
+            if (timeStep < agent * 20 || timeStep > 200 + agent * 5 || (timeStep + agent) % 7 == 0)
+            {
+                continue;
+            }
+            cyclics.Insert(timeStep * 100, agent, position, timeStep * 0.5 + agent);
+            if (agent % 3 == 0)
+            {
+                cyclics.Insert(timeStep * 100, agent, name, "Agent" + std::to_string(agent));
+            }
+            else if (timeStep % 2 == 0)
+            {
+                cyclics.Insert(timeStep * 100, agent, name, timeStep);
+            }
+            else
+            {
+                cyclics.Insert(timeStep * 100, agent, name, std::vector<int>{agent, timeStep});
+            }
+        }
+    }
+}
+
+std::vector<std::pair<int, std::string>> GetSamplesLines(ObservationCyclics& cyclics)
+{
+    std::vector<std::pair<int, std::string>> samplesLines;
+    cyclics.ForEachSamplesLine([&samplesLines](int timeStep, const std::string& samplesLine)
+    {
+        samplesLines.emplace_back(timeStep, samplesLine);
+    });
+    return samplesLines;
+}
+} // namespace
+
+TEST(ObservationCyclics_Test, ForEachSamplesLineWithStreaming_ReturnsSameLinesAsWithoutStreaming)
+{
+    ObservationCyclics cyclics;
+    ObservationCyclics streamedCyclics;
+    streamedCyclics.EnableStreaming(::testing::TempDir() + "ObservationCyclics_Test.tmp");
+
+    for (int numberOfTimeSteps : {350, 42})
+    {
+        cyclics.Clear();
+        streamedCyclics.Clear();
+        InsertRun(cyclics, numberOfTimeSteps);
+        InsertRun(streamedCyclics, numberOfTimeSteps);
+
+        ASSERT_THAT(streamedCyclics.GetHeader(), Eq(cyclics.GetHeader()));
+        const auto samplesLines = GetSamplesLines(cyclics);
+        ASSERT_THAT(samplesLines, ::testing::Not(::testing::IsEmpty()));
+        ASSERT_THAT(GetSamplesLines(streamedCyclics), ::testing::ContainerEq(samplesLines));
+    }
+}
+
 TEST(RunStatisticCalculation_Test, DetermineEgoCollisionWithEgoCollision_SetsEgoCollisionTrue)
 {
     NiceMock<FakeWorld> fakeWorld;
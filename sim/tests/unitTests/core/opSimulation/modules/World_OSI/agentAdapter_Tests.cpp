@@ -12,7 +12,12 @@
 #include "gmock/gmock.h"
 
 #include "AgentAdapter.h"
+#include "Localization.h"
 #include "fakeMovingObject.h"
+#include "fakeWorldData.h"
+#include "fakeLane.h"
+#include "fakeRoad.h"
+#include "Generators/laneGeometryElementGenerator.h"
 
 using ::testing::Return;
 using ::testing::ReturnRef;
@@ -25,6 +30,11 @@ using ::testing::Lt;
 using ::testing::AllOf;
 using ::testing::DoubleEq;
 using ::testing::ElementsAreArray;
+using ::testing::ElementsAre;
+using ::testing::NiceMock;
+using ::testing::Ref;
+using ::testing::ReturnPointee;
+using ::testing::Invoke;
 
 TEST(MovingObject_Tests, SetAndGetReferencePointPosition_ReturnsCorrectPosition)
 {
@@ -165,3 +175,88 @@ CalculateBoundingBoxData{M_PI_2,  0.0, {{11.0, 17.0},{9.0, 17.0}, {9.0, 23.0}, {
 CalculateBoundingBoxData{0.0,  M_PI_4, {{7.0, 20 - 2.6*M_SQRT1_2},{7.0, 20.0 + M_SQRT1_2}, {13.0, 20.0  + M_SQRT1_2}, {13.0, 20.0 - 2.6*M_SQRT1_2}}},
 CalculateBoundingBoxData{0.0, -M_PI_4, {{7.0, 20 - M_SQRT1_2},{7.0, 20.0 + 2.6*M_SQRT1_2}, {13.0, 20.0  + 2.6*M_SQRT1_2}, {13.0, 20.0 - M_SQRT1_2}}}
 ));
+
+class AgentAdapterUpdate_Tests : public ::testing::Test
+{
+public:
+    AgentAdapterUpdate_Tests()
+    {
+        ON_CALL(lane1, GetId()).WillByDefault(Return(idLane1));
+        ON_CALL(lane1, GetOdId()).WillByDefault(Return(-1));
+        ON_CALL(lane1, GetWidth(_)).WillByDefault(Return(4));
+        ON_CALL(lane1, GetRoad()).WillByDefault(ReturnRef(road));
+        ON_CALL(lane1, GetLaneGeometryElements()).WillByDefault(ReturnRef(elements1));
+        ON_CALL(lane2, GetId()).WillByDefault(Return(idLane2));
+        ON_CALL(lane2, GetOdId()).WillByDefault(Return(-2));
+        ON_CALL(lane2, GetWidth(_)).WillByDefault(Return(4));
+        ON_CALL(lane2, GetRoad()).WillByDefault(ReturnRef(road));
+        ON_CALL(lane2, GetLaneGeometryElements()).WillByDefault(ReturnRef(elements2));
+        ON_CALL(road, GetId()).WillByDefault(ReturnRef(idRoad));
+        ON_CALL(worldData, GetLanes()).WillByDefault(ReturnRef(lanes));
+        localizer.Init();
+
+        ON_CALL(movingObject, GetReferencePointPosition()).WillByDefault(ReturnPointee(&position));
+        ON_CALL(movingObject, GetAbsOrientation()).WillByDefault(Return(OWL::Primitive::AbsOrientation{0.0, 0.0, 0.0}));
+        ON_CALL(movingObject, GetDimension()).WillByDefault(Return(OWL::Primitive::Dimension{2.0, 1.0, 1.5}));
+        ON_CALL(movingObject, GetDistanceReferencePointToLeadingEdge()).WillByDefault(Return(1.0));
+        ON_CALL(movingObject, GetLaneAssignments()).WillByDefault(ReturnRef(laneAssignments));
+        ON_CALL(movingObject, AddLaneAssignment(_)).WillByDefault(Invoke([this](const OWL::Interfaces::Lane& lane)
+        {
+            laneAssignments.push_back(&lane);
+        }));
+        ON_CALL(movingObject, ClearLaneAssignments()).WillByDefault(Invoke([this]
+        {
+            laneAssignments.clear();
+        }));
+        ON_CALL(worldData, AddMovingObject(_, _)).WillByDefault(ReturnRef(movingObject));
+
+        agent = std::make_unique<AgentAdapter>(openpass::type::EntityId{0}, nullptr, nullptr, &worldData, localizer);
+    }
+
+    NiceMock<OWL::Fakes::WorldData> worldData;
+    NiceMock<OWL::Fakes::Lane> lane1, lane2;
+    OWL::Id idLane1{1}, idLane2{2};
+    std::unordered_map<OWL::Id, OWL::Interfaces::Lane*> lanes{{idLane1, &lane1}, {idLane2, &lane2}};
+    NiceMock<OWL::Fakes::Road> road;
+    std::string idRoad{"Road"};
+    OWL::Primitive::LaneGeometryElement laneGeometryElement1{OWL::Testing::LaneGeometryElementGenerator::RectangularLaneGeometryElement({0.0, 0.0}, 4.0, 4.0, 0.0, &lane1)};
+    OWL::Interfaces::LaneGeometryElements elements1{&laneGeometryElement1};
+    OWL::Primitive::LaneGeometryElement laneGeometryElement2{OWL::Testing::LaneGeometryElementGenerator::RectangularLaneGeometryElement({10.0, 0.0}, 4.0, 4.0, 0.0, &lane2)};
+    OWL::Interfaces::LaneGeometryElements elements2{&laneGeometryElement2};
+    World::Localization::Localizer localizer{worldData};
+
+    NiceMock<OWL::Fakes::MovingObject> movingObject;
+    OWL::Primitive::AbsPosition position{2.0, 0.0, 0.0};
+    OWL::Interfaces::Lanes laneAssignments;
+    std::unique_ptr<AgentAdapter> agent;
+};
+
+TEST_F(AgentAdapterUpdate_Tests, UpdateWithUnchangedPose_KeepsLaneAssignments)
+{
+    ASSERT_TRUE(agent->Update());
+    ASSERT_THAT(laneAssignments, ElementsAre(&lane1));
+
+    EXPECT_CALL(lane1, RemoveMovingObject(_)).Times(0);
+    EXPECT_CALL(lane1, AddMovingObject(_, _)).Times(0);
+    EXPECT_CALL(movingObject, ClearLaneAssignments()).Times(0);
+    EXPECT_CALL(movingObject, SetLocatedPosition(_)).Times(0);
+
+    ASSERT_TRUE(agent->Update());
+    ASSERT_THAT(laneAssignments, ElementsAre(&lane1));
+}
+
+TEST_F(AgentAdapterUpdate_Tests, UpdateWithChangedPose_MovesAgentFromPreviousToNewLanes)
+{
+    ASSERT_TRUE(agent->Update());
+    ASSERT_THAT(laneAssignments, ElementsAre(&lane1));
+
+    position.x = 12.0;
+
+    EXPECT_CALL(lane1, RemoveMovingObject(Ref(movingObject))).Times(1);
+    EXPECT_CALL(lane1, AddMovingObject(_, _)).Times(0);
+    EXPECT_CALL(lane2, RemoveMovingObject(_)).Times(0);
+    EXPECT_CALL(lane2, AddMovingObject(Ref(movingObject), _)).Times(1);
+
+    ASSERT_TRUE(agent->Update());
+    ASSERT_THAT(laneAssignments, ElementsAre(&lane2));
+}
@@ -48,6 +48,99 @@ TEST(EgoAgent_Test, GetDistanceToEndOfLane)
     ASSERT_THAT(result, Eq(123));
 }
 
+TEST(EgoAgent_Test, GetDistanceToEndOfLane_SameQueryTwice_IsEvaluatedOnce)
+{
+    NiceMock<FakeAgent> fakeAgent;
+    NiceMock<FakeWorld> fakeWorld;
+
+    ObjectPosition agentPosition{{},{{"Road1", GlobalRoadPosition{"Road1", -2, 12, 0, 0}}},{}};
+    ON_CALL(fakeAgent, GetObjectPosition()).WillByDefault(ReturnRef(agentPosition));
+    std::vector<std::string> roads{"Road1"};
+    ON_CALL(fakeAgent, GetRoads(_)).WillByDefault(Return(roads));
+
+    RoadGraph roadGraph;
+    RoadGraphVertex root = add_vertex(RouteElement{"Road1", true}, roadGraph);
+    RoadGraphVertex target = add_vertex(RouteElement{"Road2", true}, roadGraph);
+    add_edge(root, target, roadGraph);
+
+    RouteQueryResult<double> distances{{0, 123}};
+    EXPECT_CALL(fakeWorld, GetDistanceToEndOfLane(_,_,-1,12,100)).Times(1).WillOnce(Return(distances));
+
+    EgoAgent egoAgent {&fakeAgent, &fakeWorld};
+    egoAgent.SetRoadGraph(std::move(roadGraph), root, target);
+
+    ASSERT_THAT(egoAgent.GetDistanceToEndOfLane(100, 1), Eq(123));
+    ASSERT_THAT(egoAgent.GetDistanceToEndOfLane(100, 1), Eq(123));
+    ASSERT_THAT(egoAgent.GetQueryCacheStatistics().hits, Eq(1));
+    ASSERT_THAT(egoAgent.GetQueryCacheStatistics().misses, Eq(1));
+}
+
+TEST(EgoAgent_Test, GetDistanceToEndOfLane_SameQueryAfterUpdate_IsEvaluatedAgain)
+{
+    NiceMock<FakeAgent> fakeAgent;
+    NiceMock<FakeWorld> fakeWorld;
+
+    ObjectPosition agentPosition{{},{{"Road1", GlobalRoadPosition{"Road1", -2, 12, 0, 0}}},{}};
+    ON_CALL(fakeAgent, GetObjectPosition()).WillByDefault(ReturnRef(agentPosition));
+    std::vector<std::string> roads{"Road1"};
+    ON_CALL(fakeAgent, GetRoads(_)).WillByDefault(Return(roads));
+
+    RoadGraph roadGraph;
+    RoadGraphVertex root = add_vertex(RouteElement{"Road1", true}, roadGraph);
+    RoadGraphVertex target = add_vertex(RouteElement{"Road2", true}, roadGraph);
+    add_edge(root, target, roadGraph);
+
+    RouteQueryResult<double> firstDistances{{0, 123}};
+    RouteQueryResult<double> secondDistances{{0, 100}};
+    EXPECT_CALL(fakeWorld, GetDistanceToEndOfLane(_,_,-1,12,100)).Times(2)
+            .WillOnce(Return(firstDistances))
+            .WillOnce(Return(secondDistances));
+
+    EgoAgent egoAgent {&fakeAgent, &fakeWorld};
+    egoAgent.SetRoadGraph(std::move(roadGraph), root, target);
+
+    ASSERT_THAT(egoAgent.GetDistanceToEndOfLane(100, 1), Eq(123));
+    egoAgent.Update();
+    ASSERT_THAT(egoAgent.GetDistanceToEndOfLane(100, 1), Eq(100));
+    ASSERT_THAT(egoAgent.GetQueryCacheStatistics().hits, Eq(0));
+    ASSERT_THAT(egoAgent.GetQueryCacheStatistics().misses, Eq(2));
+}
+
+TEST(EgoAgent_Test, GetDistanceToEndOfLane_SameQueryInNextWorldGeneration_IsEvaluatedAgain)
+{
+    NiceMock<FakeAgent> fakeAgent;
+    NiceMock<FakeWorld> fakeWorld;
+
+    ObjectPosition agentPosition{{},{{"Road1", GlobalRoadPosition{"Road1", -2, 12, 0, 0}}},{}};
+    ON_CALL(fakeAgent, GetObjectPosition()).WillByDefault(ReturnRef(agentPosition));
+    std::vector<std::string> roads{"Road1"};
+    ON_CALL(fakeAgent, GetRoads(_)).WillByDefault(Return(roads));
+
+    RoadGraph roadGraph;
+    RoadGraphVertex root = add_vertex(RouteElement{"Road1", true}, roadGraph);
+    RoadGraphVertex target = add_vertex(RouteElement{"Road2", true}, roadGraph);
+    add_edge(root, target, roadGraph);
+
+    RouteQueryResult<double> firstDistances{{0, 123}};
+    RouteQueryResult<double> secondDistances{{0, 100}};
+    EXPECT_CALL(fakeWorld, GetDistanceToEndOfLane(_,_,-1,12,100)).Times(2)
+            .WillOnce(Return(firstDistances))
+            .WillOnce(Return(secondDistances));
+    EXPECT_CALL(fakeWorld, GetGeneration())
+            .WillOnce(Return(1))
+            .WillOnce(Return(1))
+            .WillRepeatedly(Return(2));
+
+    EgoAgent egoAgent {&fakeAgent, &fakeWorld};
+    egoAgent.SetRoadGraph(std::move(roadGraph), root, target);
+
+    ASSERT_THAT(egoAgent.GetDistanceToEndOfLane(100, 1), Eq(123));
+    ASSERT_THAT(egoAgent.GetDistanceToEndOfLane(100, 1), Eq(123));
+    ASSERT_THAT(egoAgent.GetDistanceToEndOfLane(100, 1), Eq(100));
+    ASSERT_THAT(egoAgent.GetQueryCacheStatistics().hits, Eq(1));
+    ASSERT_THAT(egoAgent.GetQueryCacheStatistics().misses, Eq(2));
+}
+
 TEST(EgoAgent_Test, GetObjectsInRange)
 {
     NiceMock<FakeAgent> fakeAgent;
@@ -775,3 +775,53 @@ TEST(GetLaneDirection, LaneWidthQueryOnRotatedCurvedLane_ReturnsCorrectDirection
     ASSERT_DOUBLE_EQ(lane.GetDirection(length / 2.0), direction1 + (direction2 - direction1) * length / 2.0);
     ASSERT_DOUBLE_EQ(lane.GetDirection(length), direction2);
 }
+
+TEST(RemoveMovingObject, ObjectInLane_IsRemovedAndOrderOfOtherObjectsIsKept)
+{
+    osi3::Lane osiLane;
+    OWL::Implementation::Lane lane(&osiLane, nullptr, -1);
+
+    OWL::Fakes::MovingObject firstObject, secondObject, thirdObject;
+    OWL::LaneOverlap firstOverlap{0.0, 5.0, 0.0, 0.0};
+    OWL::LaneOverlap secondOverlap{10.0, 15.0, 0.0, 0.0};
+    OWL::LaneOverlap thirdOverlap{20.0, 25.0, 0.0, 0.0};
+    lane.AddMovingObject(thirdObject, thirdOverlap);
+    lane.AddMovingObject(firstObject, firstOverlap);
+    lane.AddMovingObject(secondObject, secondOverlap);
+    lane.GetWorldObjects(true);
+
+    lane.RemoveMovingObject(secondObject);
+
+    const auto& downstreamObjects = lane.GetWorldObjects(true);
+    ASSERT_THAT(downstreamObjects.size(), Eq(2));
+    ASSERT_THAT(downstreamObjects.at(0).second, Eq(&firstObject));
+    ASSERT_THAT(downstreamObjects.at(1).second, Eq(&thirdObject));
+
+    const auto& upstreamObjects = lane.GetWorldObjects(false);
+    ASSERT_THAT(upstreamObjects.size(), Eq(2));
+    ASSERT_THAT(upstreamObjects.at(0).second, Eq(&thirdObject));
+    ASSERT_THAT(upstreamObjects.at(1).second, Eq(&firstObject));
+}
+
+TEST(AddMovingObject, ObjectsWithEqualOverlap_AreOrderedById)
+{
+    osi3::Lane osiLane;
+    OWL::Implementation::Lane lane(&osiLane, nullptr, -1);
+
+    OWL::Fakes::MovingObject firstObject, secondObject;
+    ON_CALL(firstObject, GetId()).WillByDefault(Return(1));
+    ON_CALL(secondObject, GetId()).WillByDefault(Return(2));
+    OWL::LaneOverlap overlap{10.0, 15.0, 0.0, 0.0};
+    lane.AddMovingObject(secondObject, overlap);
+    lane.AddMovingObject(firstObject, overlap);
+
+    const auto& downstreamObjects = lane.GetWorldObjects(true);
+    ASSERT_THAT(downstreamObjects.size(), Eq(2));
+    ASSERT_THAT(downstreamObjects.at(0).second, Eq(&firstObject));
+    ASSERT_THAT(downstreamObjects.at(1).second, Eq(&secondObject));
+
+    const auto& upstreamObjects = lane.GetWorldObjects(false);
+    ASSERT_THAT(upstreamObjects.size(), Eq(2));
+    ASSERT_THAT(upstreamObjects.at(0).second, Eq(&firstObject));
+    ASSERT_THAT(upstreamObjects.at(1).second, Eq(&secondObject));
+}
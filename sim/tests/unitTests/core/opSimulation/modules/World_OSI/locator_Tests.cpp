@@ -206,6 +206,30 @@ TEST_F(LocateTest, WorldObject_OffRoute)
     ASSERT_THAT(result.position.mainLocatePoint.size(), Eq(0));
 }
 
+TEST_F(LocateTest, WorldObject_LocateWithoutAssignment_ReturnsResultOfLocateIncludingLaneOverlaps)
+{
+    OWL::Fakes::MovingObject object;
+    OWL::Primitive::AbsPosition referencePoint;
+    referencePoint.x = 2;
+    referencePoint.y = 2;
+    OWL::Primitive::AbsOrientation orientation;
+    orientation.yaw = 0;
+    ON_CALL(object, GetReferencePointPosition()).WillByDefault(Return(referencePoint));
+    ON_CALL(object, GetAbsOrientation()).WillByDefault(Return(orientation));
+    ON_CALL(object, GetDistanceReferencePointToLeadingEdge()).WillByDefault(Return(1));
+    polygon_t boundingBox{{{1,1},{1,3},{3,3},{3,1}}};
+    const auto result = localizer.LocateWithoutAssignment(boundingBox, object);
+    const auto expectedResult = localizer.Locate(boundingBox, object);
+
+    ASSERT_THAT(result.isOnRoute, Eq(expectedResult.isOnRoute));
+    ASSERT_THAT(result.position.touchedRoads.size(), Eq(expectedResult.position.touchedRoads.size()));
+    ASSERT_THAT(result.position.referencePoint.size(), Eq(expectedResult.position.referencePoint.size()));
+    ASSERT_THAT(result.position.mainLocatePoint.size(), Eq(expectedResult.position.mainLocatePoint.size()));
+    ASSERT_THAT(result.laneOverlaps.size(), Eq(2));
+    ASSERT_THAT(result.laneOverlaps.count(&lane1), Eq(1));
+    ASSERT_THAT(result.laneOverlaps.count(&lane3), Eq(1));
+}
+
 bool operator== (const GlobalRoadPosition& lhs, const GlobalRoadPosition& rhs)
 {
     return lhs.roadId == rhs.roadId
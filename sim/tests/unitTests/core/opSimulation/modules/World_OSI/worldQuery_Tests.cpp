@@ -1606,6 +1606,92 @@ TEST(CreateLaneMultiStream, LinearGraphLanesDontContinue)
     ASSERT_THAT(node2.next, IsEmpty());
 }
 
+TEST(CreateLaneMultiStream, SameTopology_ReturnsSharedStream)
+{
+    Fakes::WorldData worldData;
+    RoadGraph roadGraph;
+    auto vertexA = add_vertex(RouteElement{"RoadA", true}, roadGraph);
+    auto vertexB = add_vertex(RouteElement{"RoadB", false}, roadGraph);
+    add_edge(vertexA, vertexB, roadGraph);
+    RoadGraph sameRoadGraph{roadGraph};
+    RoadGraph otherRoadGraph{roadGraph};
+    auto vertexC = add_vertex(RouteElement{"RoadC", true}, otherRoadGraph);
+    add_edge(vertexB, vertexC, otherRoadGraph);
+
+    Fakes::Road roadA;
+    Fakes::Section sectionA;
+    Fakes::Lane laneA;
+    std::string idRoadA = "RoadA";
+    OWL::Id idLaneA = 2;
+    ON_CALL(roadA, GetId()).WillByDefault(ReturnRef(idRoadA));
+    ON_CALL(laneA, GetId()).WillByDefault(Return(idLaneA));
+    ON_CALL(laneA, GetOdId()).WillByDefault(Return(-1));
+    ON_CALL(laneA, GetRoad()).WillByDefault(ReturnRef(roadA));
+    ON_CALL(laneA, GetLength()).WillByDefault(Return(100));
+    ON_CALL(laneA, Exists()).WillByDefault(Return(true));
+    OWL::Interfaces::Sections sectionsA{&sectionA};
+    ON_CALL(roadA, GetSections()).WillByDefault(ReturnRef(sectionsA));
+    OWL::Interfaces::Lanes lanesA{&laneA};
+    ON_CALL(sectionA, GetLanes()).WillByDefault(ReturnRef(lanesA));
+    ON_CALL(sectionA, Covers(_)).WillByDefault(Return(true));
+
+    std::vector<OWL::Id> successorsLanesA {};
+    ON_CALL(laneA, GetNext()).WillByDefault(ReturnRef(successorsLanesA));
+
+    std::unordered_map<std::string, OWL::Road*> roads {{idRoadA, &roadA}};
+    ON_CALL(worldData, GetRoads()).WillByDefault(ReturnRef(roads));
+    std::unordered_map<OWL::Id, OWL::Lane*> lanes {{idLaneA, &laneA}};
+    ON_CALL(worldData, GetLanes()).WillByDefault(ReturnRef(lanes));
+    WorldDataQuery wdQuery(worldData);
+
+    auto laneMultiStream = wdQuery.CreateLaneMultiStream(roadGraph, vertexA, -1, 0.0);
+    auto sameLaneMultiStream = wdQuery.CreateLaneMultiStream(sameRoadGraph, vertexA, -1, 50.0);
+    auto otherLaneMultiStream = wdQuery.CreateLaneMultiStream(otherRoadGraph, vertexA, -1, 0.0);
+
+    ASSERT_THAT(sameLaneMultiStream, Eq(laneMultiStream));
+    ASSERT_THAT(otherLaneMultiStream, Ne(laneMultiStream));
+    ASSERT_THAT(otherLaneMultiStream->GetRoot().next.front().next, SizeIs(1));
+}
+
+TEST(CreateLaneMultiStream, ClearedCache_ReturnsNewStream)
+{
+    Fakes::WorldData worldData;
+    RoadGraph roadGraph;
+    auto vertexA = add_vertex(RouteElement{"RoadA", true}, roadGraph);
+
+    Fakes::Road roadA;
+    Fakes::Section sectionA;
+    Fakes::Lane laneA;
+    std::string idRoadA = "RoadA";
+    OWL::Id idLaneA = 2;
+    ON_CALL(roadA, GetId()).WillByDefault(ReturnRef(idRoadA));
+    ON_CALL(laneA, GetId()).WillByDefault(Return(idLaneA));
+    ON_CALL(laneA, GetOdId()).WillByDefault(Return(-1));
+    ON_CALL(laneA, GetRoad()).WillByDefault(ReturnRef(roadA));
+    ON_CALL(laneA, GetLength()).WillByDefault(Return(100));
+    ON_CALL(laneA, Exists()).WillByDefault(Return(true));
+    OWL::Interfaces::Sections sectionsA{&sectionA};
+    ON_CALL(roadA, GetSections()).WillByDefault(ReturnRef(sectionsA));
+    OWL::Interfaces::Lanes lanesA{&laneA};
+    ON_CALL(sectionA, GetLanes()).WillByDefault(ReturnRef(lanesA));
+    ON_CALL(sectionA, Covers(_)).WillByDefault(Return(true));
+
+    std::vector<OWL::Id> successorsLanesA {};
+    ON_CALL(laneA, GetNext()).WillByDefault(ReturnRef(successorsLanesA));
+
+    std::unordered_map<std::string, OWL::Road*> roads {{idRoadA, &roadA}};
+    ON_CALL(worldData, GetRoads()).WillByDefault(ReturnRef(roads));
+    std::unordered_map<OWL::Id, OWL::Lane*> lanes {{idLaneA, &laneA}};
+    ON_CALL(worldData, GetLanes()).WillByDefault(ReturnRef(lanes));
+    WorldDataQuery wdQuery(worldData);
+
+    auto laneMultiStream = wdQuery.CreateLaneMultiStream(roadGraph, vertexA, -1, 0.0);
+    wdQuery.ClearMultiStreamCache();
+    auto newLaneMultiStream = wdQuery.CreateLaneMultiStream(roadGraph, vertexA, -1, 0.0);
+
+    ASSERT_THAT(newLaneMultiStream, Ne(laneMultiStream));
+}
+
 TEST(CreateLaneMultiStream, BranchingGraphOneLanePerRoad)
 {
     Fakes::WorldData worldData;
@@ -144,6 +144,43 @@ TEST(SimulationConfigImporter_UnitTests, ImportExperimentConfigSuccessfully)
     EXPECT_THAT(experimentConfig.randomSeed,          12345);
 }
 
+TEST(SimulationConfigImporter_UnitTests, ImportExperimentConfigWithNumberOfThreads_ParsesNumberOfThreads)
+{
+    QDomElement fakeDocumentRoot = documentRootFromString(
+                                       "<root>"
+                                       "<ExperimentID>1337</ExperimentID>"
+                                       "<NumberOfInvocations>5</NumberOfInvocations>"
+                                       "<RandomSeed>12345</RandomSeed>"
+                                       "<NumberOfThreads>4</NumberOfThreads>"
+                                       "</root>"
+                                   );
+
+    ExperimentConfig experimentConfig;
+
+    EXPECT_NO_THROW(SimulationConfigImporter::ImportExperiment(fakeDocumentRoot, experimentConfig));
+
+    EXPECT_THAT(experimentConfig.numberOfThreads, 4);
+}
+
+TEST(SimulationConfigImporter_UnitTests, ImportExperimentConfigWithNumberOfConcurrentInvocations_ParsesNumberOfConcurrentInvocations)
+{
+    QDomElement fakeDocumentRoot = documentRootFromString(
+                                       "<root>"
+                                       "<ExperimentID>1337</ExperimentID>"
+                                       "<NumberOfInvocations>5</NumberOfInvocations>"
+                                       "<RandomSeed>12345</RandomSeed>"
+                                       "<NumberOfConcurrentInvocations>2</NumberOfConcurrentInvocations>"
+                                       "</root>"
+                                   );
+
+    ExperimentConfig experimentConfig;
+
+    EXPECT_NO_THROW(SimulationConfigImporter::ImportExperiment(fakeDocumentRoot, experimentConfig));
+
+    EXPECT_THAT(experimentConfig.numberOfConcurrentInvocations, 2);
+    EXPECT_THAT(experimentConfig.numberOfThreads, 1);
+}
+
 TEST(SimulationConfigImporter_UnitTests, ImportExperimentConfigUnsuccessfully)
 {
     QDomElement fakeDocumentRootMissingRandomSeed = documentRootFromString(